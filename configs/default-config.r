@@ -19,6 +19,7 @@ extensions: make map! [
     ; standard C compiler with POSIX or Win32.  Disable these extensions by
     ; default.  (Review the general policy for default inclusions.)
     ; Clipboard is only implemented in Windows at the moment.
+    ; Rebin is a new serialization format, so builds have to ask for it.
 
     BMP +
     Clipboard -
@@ -38,6 +39,7 @@ extensions: make map! [
     ODBC -
     PNG +
     Process +
+    Rebin -
     Signal -
     TCC -
     Time +
@@ -482,6 +482,39 @@ DEVICE_CMD Read_File(REBREQ *file)
 }
 
 
+//
+//  Try_Map_File: C
+//
+// Used by READ/MAP to get `len` bytes from the file's current index without
+// copying them, by mapping the file into a read-only BINARY!.  Returns
+// nullptr if that's not possible (or not worth it), and the caller does an
+// ordinary read instead.
+//
+REBBIN *Try_Map_File(REBREQ *file, REBLEN len)
+{
+  #if defined(MMAP_LARGE_SERIES)
+    struct rebol_devreq *req = Req(file);
+    assert(req->requestee.id != 0);
+
+    REBBIN *bin = Try_Make_Mapped_Binary(
+        req->requestee.id,
+        ReqFile(file)->index,
+        len
+    );
+    if (not bin)
+        return nullptr;
+
+    ReqFile(file)->index += len;
+    req->modes |= RFM_RESEEK;  // the mapping didn't move the file position
+    return bin;
+  #else
+    UNUSED(file);
+    UNUSED(len);
+    return nullptr;
+  #endif
+}
+
+
 //
 //  Write_File: C
 //
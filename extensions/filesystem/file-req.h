@@ -30,6 +30,7 @@ inline static struct devreq_file* ReqFile(REBREQ *req) {
 
 extern REBVAL *File_Time_To_Rebol(REBREQ *file);
 extern REBVAL *Query_File_Or_Dir(const REBVAL *port, REBREQ *file);
+extern REBBIN *Try_Map_File(REBREQ *file, REBLEN len);
 
 #ifdef TO_WINDOWS
     #define OS_DIR_SEP '\\'  // file path separator (Thanks Bill.)
@@ -371,6 +371,21 @@ DEVICE_CMD Read_File(REBREQ *file)
 }
 
 
+//
+//  Try_Map_File: C
+//
+// !!! READ/MAP could use CreateFileMapping() here, but the series memory
+// would need a matching way to be freed (see MMAP_LARGE_SERIES).  For now
+// the caller always falls back to an ordinary read.
+//
+REBBIN *Try_Map_File(REBREQ *file, REBLEN len)
+{
+    UNUSED(file);
+    UNUSED(len);
+    return nullptr;
+}
+
+
 //
 //  Write_File: C
 //
@@ -163,6 +163,7 @@ REB_R Dir_Actor(REBFRM *frame_, REBVAL *port, const REBVAL *verb)
 
         UNUSED(PAR(string)); // handled in dispatcher
         UNUSED(PAR(lines)); // handled in dispatcher
+        UNUSED(PAR(map));  // only a hint
 
         if (not IS_BLOCK(state)) {     // !!! ignores /SKIP and /PART, for now
             REBREQ *dir = OS_Make_Devreq(&Dev_File);
@@ -379,7 +379,12 @@ REB_R File_Actor(REBFRM *frame_, REBVAL *port, const REBVAL *verb)
             Set_Seek(file, ARG(seek));
 
         REBLEN len = Set_Length(file, REF(part) ? VAL_INT64(ARG(part)) : -1);
-        Read_File_Port(D_OUT, port, file, path, flags, len);
+
+        REBBIN *mapped = REF(map) ? Try_Map_File(file, len) : nullptr;
+        if (mapped)
+            Init_Binary(D_OUT, mapped);
+        else
+            Read_File_Port(D_OUT, port, file, path, flags, len);
 
         if (opened) {
             REBVAL *result = OS_DO_DEVICE(file, RDC_CLOSE);
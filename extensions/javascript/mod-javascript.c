@@ -435,6 +435,7 @@ void RunPromise(void)
     REBARR *code = ARR(Pointer_From_Heapaddr(info->promise_id));
     assert(NOT_SERIES_FLAG(code, MANAGED));  // took off so it didn't GC
     SET_SERIES_FLAG(code, MANAGED);  // but need it back on to execute it
+    Keep_From_Lazy_Sweep(code);  // not marked if a lazy sweep is underway
 
     // We run the code using rebRescue() so that if there are errors, we
     // will be able to trap them.  the difference between `throw()`
@@ -290,6 +290,7 @@ static REB_R Transport_Actor(
 
         UNUSED(PAR(string)); // handled in dispatcher
         UNUSED(PAR(lines)); // handled in dispatcher
+        UNUSED(PAR(map));  // only a hint
 
         // Read data into a buffer, expanding the buffer if needed.
         // If no length is given, program must stop it at some point.
@@ -0,0 +1,1085 @@
+//
+//  File: %mod-rebin.c
+//  Summary: "Compact binary serialization of values"
+//  Section: extension
+//  Project: "Rebol 3 Interpreter and Run-time (Ren-C branch)"
+//  Homepage: https://github.com/metaeducation/ren-c/
+//
+//=////////////////////////////////////////////////////////////////////////=//
+//
+// Copyright 2021 Ren-C Open Source Contributors
+// REBOL is a trademark of REBOL Technologies
+//
+// See README.md and CREDITS.md for more information.
+//
+// Licensed under the Lesser GPL, Version 3.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// https://www.gnu.org/licenses/lgpl-3.0.html
+//
+//=////////////////////////////////////////////////////////////////////////=//
+//
+// Saving data with MOLD builds up text that LOAD then has to scan again, and
+// every word goes through interning once per occurrence.  The "rebin" format
+// is a binary alternative for data: words are interned once from a symbol
+// table at the front, numbers are stored in their binary forms, and series
+// that are referenced more than once (including cyclically) come back shared
+// as they were, instead of as copies.
+//
+// The layout is:
+//
+//     "REBIN" version flags
+//     [original-size] ; only if flags has REBIN_FLAG_DEFLATE
+//     payload ; raw DEFLATE of the payload if REBIN_FLAG_DEFLATE
+//
+// The payload is a count of symbols, each symbol as a size and its UTF-8,
+// and then a single value.  Each value starts with a tag byte, with the high
+// bit set if the value had a newline before it in its array.  Integers in
+// the format (sizes, counts, indices) are unsigned LEB128, and INTEGER! is
+// stored zigzag-encoded in the same way.
+//
+// Series are written as a reference number: 0 if the series content comes
+// right after, or 1 + the position of an earlier series in the order they
+// were defined.  Series are numbered before their content is written, which
+// is what lets arrays contain themselves.
+//
+// Binding is not preserved, the same as it is not with MOLD.  Less common
+// types that MOLD and LOAD round trip (DATE!, TIME!, MONEY!, PATH!, etc.)
+// are stored as their molded text.  Types that can't be round tripped, such
+// as ACTION! or PORT!, are errors.
+//
+
+#include "sys-core.h"
+
+#include "tmp-mod-rebin.h"
+
+
+#define REBIN_VERSION 1
+
+#define REBIN_FLAG_DEFLATE 0x01
+
+static const REBYTE Rebin_Magic[] = {'R', 'E', 'B', 'I', 'N'};
+
+#define REBIN_HEADER_SIZE (sizeof(Rebin_Magic) + 2)  // + version and flags
+
+
+// The tags are separate from the REB_XXX kinds, so that reordering %types.r
+// does not change the format.
+//
+enum Reb_Rebin_Tag {
+    REBIN_NULL,  // only in context variables, or when quoted
+    REBIN_BLANK,
+    REBIN_FALSE,
+    REBIN_TRUE,
+    REBIN_INTEGER,
+    REBIN_DECIMAL,
+    REBIN_PERCENT,
+    REBIN_WORD,
+    REBIN_SET_WORD,
+    REBIN_GET_WORD,
+    REBIN_META_WORD,
+    REBIN_BAD_WORD,
+    REBIN_ISOTOPE,  // only in context variables
+    REBIN_TEXT,
+    REBIN_FILE,
+    REBIN_EMAIL,
+    REBIN_URL,
+    REBIN_TAG,
+    REBIN_BINARY,
+    REBIN_BLOCK,
+    REBIN_GROUP,
+    REBIN_SET_BLOCK,
+    REBIN_SET_GROUP,
+    REBIN_GET_BLOCK,
+    REBIN_GET_GROUP,
+    REBIN_META_BLOCK,
+    REBIN_META_GROUP,
+    REBIN_OBJECT,
+    REBIN_MAP,
+    REBIN_QUOTED,
+    REBIN_MOLDED,
+    REBIN_MAX
+};
+
+#define REBIN_NEWLINE_BEFORE 0x80
+
+STATIC_ASSERT(REBIN_MAX <= REBIN_NEWLINE_BEFORE);
+
+static const enum Reb_Kind Rebin_Kinds[REBIN_MAX] = {
+    REB_NULL,
+    REB_BLANK,
+    REB_LOGIC,
+    REB_LOGIC,
+    REB_INTEGER,
+    REB_DECIMAL,
+    REB_PERCENT,
+    REB_WORD,
+    REB_SET_WORD,
+    REB_GET_WORD,
+    REB_META_WORD,
+    REB_BAD_WORD,
+    REB_BAD_WORD,
+    REB_TEXT,
+    REB_FILE,
+    REB_EMAIL,
+    REB_URL,
+    REB_TAG,
+    REB_BINARY,
+    REB_BLOCK,
+    REB_GROUP,
+    REB_SET_BLOCK,
+    REB_SET_GROUP,
+    REB_GET_BLOCK,
+    REB_GET_GROUP,
+    REB_META_BLOCK,
+    REB_META_GROUP,
+    REB_OBJECT,
+    REB_MAP,
+    REB_QUOTED,
+    REB_0  // whatever the molded text scans as
+};
+
+
+// Flags for what is legal in a position, beyond ordinary array elements.
+//
+#define REBIN_FLAG_ALLOW_NULL 0x01
+#define REBIN_FLAG_ALLOW_ISOTOPE 0x02
+
+#define REBIN_MASK_VAR \
+    (REBIN_FLAG_ALLOW_NULL | REBIN_FLAG_ALLOW_ISOTOPE)
+
+
+//=//// ENCODING //////////////////////////////////////////////////////////=//
+//
+// The encoder needs to know if a symbol or series has been seen before, and
+// what number it was given.  That is kept in an open-addressed hash table
+// of node pointers.  A series can be seen as more than one category (e.g. a
+// string aliased AS BINARY!) and each category gets its own number, so the
+// decoder never has to reinterpret a series it made as something else.
+//
+
+enum Reb_Rebin_Category {
+    REBIN_CATEGORY_NONE,
+    REBIN_CATEGORY_SYMBOL,
+    REBIN_CATEGORY_STRING,
+    REBIN_CATEGORY_BINARY,
+    REBIN_CATEGORY_ARRAY,
+    REBIN_CATEGORY_OBJECT,
+    REBIN_CATEGORY_MAP
+};
+
+struct Reb_Rebin_Entry {
+    const void *node;
+    REBLEN id;
+    enum Reb_Rebin_Category category;
+};
+
+typedef struct {
+    REBBIN *symbols;  // symbol table section, written as symbols are seen
+    REBBIN *body;  // the value, written in one pass
+
+    struct Reb_Rebin_Entry *table;
+    REBLEN table_size;  // always a power of 2
+    REBLEN table_used;
+
+    REBLEN num_symbols;
+    REBLEN num_series;
+} REBIN_ENCODER;
+
+
+static void Write_Bytes(REBBIN *bin, const REBYTE *data, REBSIZ size)
+{
+    REBLEN old_len = BIN_LEN(bin);
+    EXPAND_SERIES_TAIL(bin, size);
+    memcpy(BIN_AT(bin, old_len), data, size);
+}
+
+static void Write_Byte(REBBIN *bin, REBYTE b)
+{
+    REBLEN old_len = BIN_LEN(bin);
+    EXPAND_SERIES_TAIL(bin, 1);
+    *BIN_AT(bin, old_len) = b;
+}
+
+static void Write_Uint(REBBIN *bin, REBU64 u)
+{
+    REBYTE buf[10];  // enough for 64 bits at 7 bits per byte
+    REBLEN n = 0;
+    while (u >= 0x80) {
+        buf[n++] = cast(REBYTE, u | 0x80);
+        u >>= 7;
+    }
+    buf[n++] = cast(REBYTE, u);
+    Write_Bytes(bin, buf, n);
+}
+
+static void Write_Double(REBBIN *bin, REBDEC d)
+{
+    REBU64 u;
+    memcpy(&u, &d, sizeof(u));
+
+    REBYTE buf[8];  // always little endian, regardless of platform
+    REBLEN n;
+    for (n = 0; n < 8; ++n, u >>= 8)
+        buf[n] = cast(REBYTE, u & 0xFF);
+    Write_Bytes(bin, buf, 8);
+}
+
+
+static struct Reb_Rebin_Entry *Find_Rebin_Entry(
+    REBIN_ENCODER *e,
+    const void *node,
+    enum Reb_Rebin_Category category
+){
+    uintptr_t hash = cast(uintptr_t, node) >> 4;
+    hash = (hash * 2654435761u) ^ category;
+
+    REBLEN mask = e->table_size - 1;
+    REBLEN slot = hash & mask;
+    while (true) {
+        struct Reb_Rebin_Entry *entry = &e->table[slot];
+        if (entry->node == nullptr)
+            return entry;
+        if (entry->node == node and entry->category == category)
+            return entry;
+        slot = (slot + 1) & mask;
+    }
+}
+
+// Takes the id for a node not yet in the table, and keeps the table at most
+// half full.  (Entry pointers are invalidated.)
+//
+static void Add_Rebin_Entry(
+    REBIN_ENCODER *e,
+    struct Reb_Rebin_Entry *entry,
+    const void *node,
+    enum Reb_Rebin_Category category,
+    REBLEN id
+){
+    entry->node = node;
+    entry->category = category;
+    entry->id = id;
+
+    if (++e->table_used * 2 <= e->table_size)
+        return;
+
+    struct Reb_Rebin_Entry *old_table = e->table;
+    REBLEN old_size = e->table_size;
+
+    e->table_size = old_size * 2;
+    e->table = rebAllocN(struct Reb_Rebin_Entry, e->table_size);
+    memset(e->table, 0, sizeof(struct Reb_Rebin_Entry) * e->table_size);
+
+    REBLEN n;
+    for (n = 0; n < old_size; ++n) {
+        if (old_table[n].node == nullptr)
+            continue;
+        *Find_Rebin_Entry(e, old_table[n].node, old_table[n].category)
+            = old_table[n];
+    }
+    rebFree(old_table);
+}
+
+
+static void Write_Symbol(REBIN_ENCODER *e, const REBSYM *symbol)
+{
+    struct Reb_Rebin_Entry *entry = Find_Rebin_Entry(
+        e, symbol, REBIN_CATEGORY_SYMBOL
+    );
+    if (entry->node) {
+        Write_Uint(e->body, entry->id);
+        return;
+    }
+
+    REBLEN id = e->num_symbols++;
+    Add_Rebin_Entry(e, entry, symbol, REBIN_CATEGORY_SYMBOL, id);
+
+    Write_Uint(e->symbols, STR_SIZE(symbol));
+    Write_Bytes(e->symbols, STR_HEAD(symbol), STR_SIZE(symbol));
+
+    Write_Uint(e->body, id);
+}
+
+
+// Returns true if this is the first time the series was seen, in which case
+// the caller has to write out its content.
+//
+static bool Write_Series_Ref(
+    REBIN_ENCODER *e,
+    const void *node,
+    enum Reb_Rebin_Category category
+){
+    struct Reb_Rebin_Entry *entry = Find_Rebin_Entry(e, node, category);
+    if (entry->node) {
+        Write_Uint(e->body, cast(REBU64, entry->id) + 1);
+        return false;
+    }
+
+    Add_Rebin_Entry(e, entry, node, category, e->num_series++);
+    Write_Uint(e->body, 0);
+    return true;
+}
+
+
+static void Encode_Value(REBIN_ENCODER *e, const RELVAL *v, REBFLGS flags)
+{
+    if (C_STACK_OVERFLOWING(&flags))
+        Fail_Stack_Overflow();
+
+    REBBIN *body = e->body;
+
+    REBYTE newline = GET_CELL_FLAG(v, NEWLINE_BEFORE)
+        ? REBIN_NEWLINE_BEFORE
+        : 0;
+
+    REBLEN depth = VAL_NUM_QUOTES(v);
+    if (depth != 0) {
+        Write_Byte(body, REBIN_QUOTED | newline);
+        Write_Uint(body, depth);
+        newline = 0;
+        flags = REBIN_FLAG_ALLOW_NULL;  // e.g. the lone apostrophe
+    }
+
+    REBCEL(const*) cell = VAL_UNESCAPED(v);
+    enum Reb_Kind kind = CELL_KIND(cell);
+
+    switch (kind) {
+      case REB_NULL:
+        if (not (flags & REBIN_FLAG_ALLOW_NULL))
+            fail (Error_Invalid_Type(kind));
+        Write_Byte(body, REBIN_NULL);
+        break;
+
+      case REB_BLANK:
+        Write_Byte(body, REBIN_BLANK | newline);
+        break;
+
+      case REB_LOGIC:
+        Write_Byte(body, (VAL_LOGIC(cell) ? REBIN_TRUE : REBIN_FALSE) | newline);
+        break;
+
+      case REB_INTEGER: {
+        REBI64 i = VAL_INT64(cell);
+        Write_Byte(body, REBIN_INTEGER | newline);
+        Write_Uint(body, (cast(REBU64, i) << 1) ^ cast(REBU64, i >> 63));
+        break; }
+
+      case REB_DECIMAL:
+      case REB_PERCENT:
+        Write_Byte(
+            body,
+            (kind == REB_DECIMAL ? REBIN_DECIMAL : REBIN_PERCENT) | newline
+        );
+        Write_Double(body, VAL_DECIMAL(cell));
+        break;
+
+      case REB_WORD:
+      case REB_SET_WORD:
+      case REB_GET_WORD:
+      case REB_META_WORD: {
+        REBYTE tag;
+        switch (kind) {
+          case REB_WORD: tag = REBIN_WORD; break;
+          case REB_SET_WORD: tag = REBIN_SET_WORD; break;
+          case REB_GET_WORD: tag = REBIN_GET_WORD; break;
+          default: tag = REBIN_META_WORD; break;
+        }
+        Write_Byte(body, tag | newline);
+        Write_Symbol(e, VAL_WORD_SYMBOL(cell));
+        break; }
+
+      case REB_BAD_WORD:
+        if (GET_CELL_FLAG(v, ISOTOPE)) {
+            if (not (flags & REBIN_FLAG_ALLOW_ISOTOPE))
+                fail (Error_Invalid_Type(kind));
+            Write_Byte(body, REBIN_ISOTOPE);
+        }
+        else
+            Write_Byte(body, REBIN_BAD_WORD | newline);
+        Write_Symbol(e, VAL_BAD_WORD_LABEL(cell));
+        break;
+
+      case REB_TEXT:
+      case REB_FILE:
+      case REB_EMAIL:
+      case REB_URL:
+      case REB_TAG: {
+        REBYTE tag;
+        switch (kind) {
+          case REB_TEXT: tag = REBIN_TEXT; break;
+          case REB_FILE: tag = REBIN_FILE; break;
+          case REB_EMAIL: tag = REBIN_EMAIL; break;
+          case REB_URL: tag = REBIN_URL; break;
+          default: tag = REBIN_TAG; break;
+        }
+        Write_Byte(body, tag | newline);
+
+        const REBSTR *s = VAL_STRING(cell);
+        if (Write_Series_Ref(e, s, REBIN_CATEGORY_STRING)) {
+            Write_Uint(body, STR_SIZE(s));
+            Write_Bytes(body, STR_HEAD(s), STR_SIZE(s));
+        }
+        Write_Uint(body, VAL_INDEX(cell));
+        break; }
+
+      case REB_BINARY: {
+        Write_Byte(body, REBIN_BINARY | newline);
+
+        const REBBIN *bin = VAL_BINARY(cell);
+        if (Write_Series_Ref(e, bin, REBIN_CATEGORY_BINARY)) {
+            Write_Uint(body, BIN_LEN(bin));
+            Write_Bytes(body, BIN_HEAD(bin), BIN_LEN(bin));
+        }
+        Write_Uint(body, VAL_INDEX(cell));
+        break; }
+
+      case REB_BLOCK:
+      case REB_GROUP:
+      case REB_SET_BLOCK:
+      case REB_SET_GROUP:
+      case REB_GET_BLOCK:
+      case REB_GET_GROUP:
+      case REB_META_BLOCK:
+      case REB_META_GROUP: {
+        REBYTE tag;
+        switch (kind) {
+          case REB_BLOCK: tag = REBIN_BLOCK; break;
+          case REB_GROUP: tag = REBIN_GROUP; break;
+          case REB_SET_BLOCK: tag = REBIN_SET_BLOCK; break;
+          case REB_SET_GROUP: tag = REBIN_SET_GROUP; break;
+          case REB_GET_BLOCK: tag = REBIN_GET_BLOCK; break;
+          case REB_GET_GROUP: tag = REBIN_GET_GROUP; break;
+          case REB_META_BLOCK: tag = REBIN_META_BLOCK; break;
+          default: tag = REBIN_META_GROUP; break;
+        }
+        Write_Byte(body, tag | newline);
+
+        const REBARR *a = VAL_ARRAY(cell);
+        REBLEN index = VAL_INDEX(cell);  // fails if past the tail
+        if (Write_Series_Ref(e, a, REBIN_CATEGORY_ARRAY)) {
+            Write_Uint(
+                body,
+                (cast(REBU64, ARR_LEN(a)) << 1)
+                    | (GET_SUBCLASS_FLAG(ARRAY, a, NEWLINE_AT_TAIL) ? 1 : 0)
+            );
+            const RELVAL *tail = ARR_TAIL(a);
+            const RELVAL *item = ARR_HEAD(a);
+            for (; item != tail; ++item)
+                Encode_Value(e, item, 0);
+        }
+        Write_Uint(e->body, index);
+        break; }
+
+      case REB_OBJECT: {
+        Write_Byte(body, REBIN_OBJECT | newline);
+
+        REBCTX *c = VAL_CONTEXT(cell);
+        if (Write_Series_Ref(e, CTX_VARLIST(c), REBIN_CATEGORY_OBJECT)) {
+            Write_Uint(body, CTX_LEN(c));
+
+            const REBKEY *key_tail;
+            const REBKEY *key = CTX_KEYS(&key_tail, c);
+            for (; key != key_tail; ++key)
+                Write_Symbol(e, KEY_SYMBOL(key));
+
+            const REBVAR *var_tail;
+            REBVAR *var = CTX_VARS(&var_tail, c);
+            for (; var != var_tail; ++var)
+                Encode_Value(e, var, REBIN_MASK_VAR);
+        }
+        break; }
+
+      case REB_MAP: {
+        Write_Byte(body, REBIN_MAP | newline);
+
+        const REBARR *pairlist = MAP_PAIRLIST(VAL_MAP(cell));
+        if (Write_Series_Ref(e, pairlist, REBIN_CATEGORY_MAP)) {
+            Write_Uint(body, Length_Map(VAL_MAP(cell)));
+
+            const RELVAL *tail = ARR_TAIL(pairlist);
+            const RELVAL *key = ARR_HEAD(pairlist);
+            for (; key != tail; key += 2) {
+                if (IS_NULLED(key + 1))  // removed, see Length_Map()
+                    continue;
+                Encode_Value(e, key, 0);
+                Encode_Value(e, key + 1, 0);
+            }
+        }
+        break; }
+
+      case REB_MONEY:
+      case REB_TIME:
+      case REB_DATE:
+      case REB_PAIR:
+      case REB_ISSUE:
+      case REB_PATH:
+      case REB_SET_PATH:
+      case REB_GET_PATH:
+      case REB_META_PATH:
+      case REB_TUPLE:
+      case REB_SET_TUPLE:
+      case REB_GET_TUPLE:
+      case REB_META_TUPLE: {
+        Write_Byte(body, REBIN_MOLDED | newline);
+
+        DECLARE_MOLD (mo);
+        Push_Mold(mo);
+        Mold_Or_Form_Cell(mo, cell, false);
+
+        REBSIZ size = STR_SIZE(mo->series) - mo->offset;
+        Write_Uint(body, size);
+        Write_Bytes(body, BIN_AT(mo->series, mo->offset), size);
+
+        Drop_Mold(mo);
+        break; }
+
+      default:
+        fail (Error_Invalid_Type(kind));
+    }
+}
+
+
+//=//// DECODING //////////////////////////////////////////////////////////=//
+//
+// Decoded values are pushed to the data stack, so everything made so far is
+// safe from GC while the rest is decoded.  Arrays, objects, and maps get
+// their series (and number) before their content is decoded, and are then
+// filled from the stack.
+//
+// The input is not trusted: any count or size is checked against how much
+// input is left before it is used to allocate anything.
+//
+
+typedef struct {
+    const REBYTE *bp;
+    const REBYTE *tail;
+
+    REBARR *symbols;  // WORD! cells, also keeps the symbols from being GC'd
+    REBARR *seen;  // a cell for each series, in the order they were defined
+} REBIN_DECODER;
+
+
+static REBYTE Read_Byte(REBIN_DECODER *d)
+{
+    if (d->bp == d->tail)
+        fail (Error_Bad_Media_Raw());
+    return *d->bp++;
+}
+
+static REBU64 Read_Uint(REBIN_DECODER *d)
+{
+    REBU64 u = 0;
+    REBLEN shift;
+    for (shift = 0; shift < 64; shift += 7) {
+        REBYTE b = Read_Byte(d);
+        u |= cast(REBU64, b & 0x7F) << shift;
+        if (not (b & 0x80))
+            return u;
+    }
+    fail (Error_Bad_Media_Raw());
+}
+
+// Sizes and counts of things that each take at least one byte of input can
+// be checked before they are used to allocate anything.
+//
+static REBLEN Read_Count(REBIN_DECODER *d)
+{
+    REBU64 u = Read_Uint(d);
+    if (u > cast(REBU64, d->tail - d->bp))
+        fail (Error_Bad_Media_Raw());
+    return cast(REBLEN, u);
+}
+
+static const REBYTE *Read_Bytes(REBIN_DECODER *d, REBSIZ size)
+{
+    const REBYTE *bp = d->bp;
+    d->bp += size;  // Read_Count() checked size
+    return bp;
+}
+
+static REBDEC Read_Double(REBIN_DECODER *d)
+{
+    if (d->tail - d->bp < 8)
+        fail (Error_Bad_Media_Raw());
+
+    REBU64 u = 0;
+    REBLEN n;
+    for (n = 0; n < 8; ++n)
+        u |= cast(REBU64, d->bp[n]) << (8 * n);
+    d->bp += 8;
+
+    REBDEC dec;
+    memcpy(&dec, &u, sizeof(dec));
+    return dec;
+}
+
+static const REBSYM *Read_Symbol(REBIN_DECODER *d)
+{
+    REBU64 id = Read_Uint(d);
+    if (id >= ARR_LEN(d->symbols))
+        fail (Error_Bad_Media_Raw());
+    return VAL_WORD_SYMBOL(ARR_AT(d->symbols, cast(REBLEN, id)));
+}
+
+// Returns the cell in the seen list for a series that was already defined,
+// or nullptr if the series content comes next.
+//
+static const RELVAL *Read_Series_Ref(REBIN_DECODER *d)
+{
+    REBU64 ref = Read_Uint(d);
+    if (ref == 0)
+        return nullptr;
+    if (ref > ARR_LEN(d->seen))
+        fail (Error_Bad_Media_Raw());
+    return ARR_AT(d->seen, cast(REBLEN, ref - 1));
+}
+
+static REBLEN Read_Index(REBIN_DECODER *d)
+{
+    REBU64 index = Read_Uint(d);
+    if (index > INT32_MAX)
+        fail (Error_Bad_Media_Raw());
+    return cast(REBLEN, index);
+}
+
+
+static void Decode_Value_Push(REBIN_DECODER *d, REBFLGS flags)
+{
+    if (C_STACK_OVERFLOWING(&flags))
+        Fail_Stack_Overflow();
+
+    REBYTE byte = Read_Byte(d);
+    bool newline = did (byte & REBIN_NEWLINE_BEFORE);
+    REBYTE tag = cast(REBYTE, byte & ~REBIN_NEWLINE_BEFORE);
+    if (tag >= REBIN_MAX)
+        fail (Error_Bad_Media_Raw());
+
+    enum Reb_Kind kind = Rebin_Kinds[tag];
+
+    switch (tag) {
+      case REBIN_NULL:
+        if (newline or not (flags & REBIN_FLAG_ALLOW_NULL))
+            fail (Error_Bad_Media_Raw());
+        Init_Nulled(DS_PUSH());
+        break;
+
+      case REBIN_BLANK:
+        Init_Blank(DS_PUSH());
+        break;
+
+      case REBIN_FALSE:
+      case REBIN_TRUE:
+        Init_Logic(DS_PUSH(), tag == REBIN_TRUE);
+        break;
+
+      case REBIN_INTEGER: {
+        REBU64 u = Read_Uint(d);
+        Init_Integer(DS_PUSH(), cast(REBI64, (u >> 1) ^ (0 - (u & 1))));
+        break; }
+
+      case REBIN_DECIMAL:
+        Init_Decimal(DS_PUSH(), Read_Double(d));
+        break;
+
+      case REBIN_PERCENT:
+        Init_Percent(DS_PUSH(), Read_Double(d));
+        break;
+
+      case REBIN_WORD:
+      case REBIN_SET_WORD:
+      case REBIN_GET_WORD:
+      case REBIN_META_WORD:
+        Init_Any_Word(DS_PUSH(), kind, Read_Symbol(d));
+        break;
+
+      case REBIN_BAD_WORD:
+        Init_Bad_Word_Core(DS_PUSH(), Read_Symbol(d), CELL_MASK_NONE);
+        break;
+
+      case REBIN_ISOTOPE:
+        if (newline or not (flags & REBIN_FLAG_ALLOW_ISOTOPE))
+            fail (Error_Bad_Media_Raw());
+        Init_Bad_Word_Core(DS_PUSH(), Read_Symbol(d), CELL_FLAG_ISOTOPE);
+        break;
+
+      case REBIN_TEXT:
+      case REBIN_FILE:
+      case REBIN_EMAIL:
+      case REBIN_URL:
+      case REBIN_TAG: {
+        const RELVAL *ref = Read_Series_Ref(d);
+        if (ref == nullptr) {
+            REBSIZ size = Read_Count(d);
+            const REBYTE *utf8 = Read_Bytes(d, size);
+            REBSTR *s = Append_UTF8_May_Fail(  // validates the UTF-8
+                nullptr, cs_cast(utf8), size, STRMODE_ALL_CODEPOINTS
+            );
+            ref = Init_Text(Alloc_Tail_Array(d->seen), s);
+        }
+        else if (not ANY_STRING(ref))
+            fail (Error_Bad_Media_Raw());
+
+        const REBSTR *s = VAL_STRING(ref);
+        REBLEN index = Read_Index(d);
+        if (index > STR_LEN(s))
+            fail (Error_Bad_Media_Raw());
+        Init_Any_String_At(DS_PUSH(), kind, s, index);
+        break; }
+
+      case REBIN_BINARY: {
+        const RELVAL *ref = Read_Series_Ref(d);
+        if (ref == nullptr) {
+            REBSIZ size = Read_Count(d);
+            REBBIN *bin = Make_Binary(size);
+            memcpy(BIN_HEAD(bin), Read_Bytes(d, size), size);
+            TERM_BIN_LEN(bin, size);
+            ref = Init_Binary(Alloc_Tail_Array(d->seen), bin);
+        }
+        else if (not IS_BINARY(ref))
+            fail (Error_Bad_Media_Raw());
+
+        const REBBIN *bin = VAL_BINARY(ref);
+        REBLEN index = Read_Index(d);
+        if (index > BIN_LEN(bin))
+            fail (Error_Bad_Media_Raw());
+        Init_Binary_At(DS_PUSH(), bin, index);
+        break; }
+
+      case REBIN_BLOCK:
+      case REBIN_GROUP:
+      case REBIN_SET_BLOCK:
+      case REBIN_SET_GROUP:
+      case REBIN_GET_BLOCK:
+      case REBIN_GET_GROUP:
+      case REBIN_META_BLOCK:
+      case REBIN_META_GROUP: {
+        const RELVAL *ref = Read_Series_Ref(d);
+        REBARR *a;
+        if (ref == nullptr) {
+            REBU64 header = Read_Uint(d);
+            if ((header >> 1) > cast(REBU64, d->tail - d->bp))
+                fail (Error_Bad_Media_Raw());
+            REBLEN len = cast(REBLEN, header >> 1);
+
+            a = Make_Array_Core(
+                len,
+                NODE_FLAG_MANAGED
+                    | ((header & 1) ? ARRAY_FLAG_NEWLINE_AT_TAIL : 0)
+            );
+            Init_Block(Alloc_Tail_Array(d->seen), a);
+
+            REBDSP dsp_orig = DSP;
+            REBLEN n;
+            for (n = 0; n < len; ++n)
+                Decode_Value_Push(d, 0);
+
+            // The array has no content until now, so a reference to it from
+            // inside itself can't have its index checked against its length.
+            // That's all right, as VAL_INDEX() checks on use.
+            //
+            RELVAL *dest = ARR_HEAD(a);
+            for (n = 0; n < len; ++n, ++dest)
+                Copy_Cell(dest, DS_AT(dsp_orig + 1 + n));
+            SET_SERIES_LEN(a, len);
+            DS_DROP_TO(dsp_orig);
+        }
+        else if (ANY_ARRAY(ref))
+            a = m_cast(REBARR*, VAL_ARRAY(ref));
+        else
+            fail (Error_Bad_Media_Raw());
+
+        Init_Any_Array_At(DS_PUSH(), kind, a, Read_Index(d));
+        break; }
+
+      case REBIN_OBJECT: {
+        const RELVAL *ref = Read_Series_Ref(d);
+        REBCTX *c;
+        if (ref == nullptr) {
+            REBLEN len = Read_Count(d);
+            c = Alloc_Context_Core(REB_OBJECT, len, NODE_FLAG_MANAGED);
+
+            const RELVAL *seen = Init_Object(Alloc_Tail_Array(d->seen), c);
+
+            // Input is untrusted, and a keylist with repeated keys would
+            // break the invariants of everything that searches it.
+            //
+            const bool strict = false;
+            REBLEN n;
+            for (n = 0; n < len; ++n) {
+                const REBSYM *symbol = Read_Symbol(d);
+                if (Find_Symbol_In_Context(seen, symbol, strict) != 0)
+                    fail (Error_Bad_Media_Raw());
+                Append_Context(c, nullptr, symbol);
+            }
+
+            REBDSP dsp_orig = DSP;
+            for (n = 0; n < len; ++n)
+                Decode_Value_Push(d, REBIN_MASK_VAR);
+
+            REBVAR *var = CTX_VARS_HEAD(c);
+            for (n = 0; n < len; ++n, ++var)
+                Copy_Cell(var, DS_AT(dsp_orig + 1 + n));
+            DS_DROP_TO(dsp_orig);
+        }
+        else if (IS_OBJECT(ref))
+            c = VAL_CONTEXT(ref);
+        else
+            fail (Error_Bad_Media_Raw());
+
+        Init_Object(DS_PUSH(), c);
+        break; }
+
+      case REBIN_MAP: {
+        const RELVAL *ref = Read_Series_Ref(d);
+        REBMAP *map;
+        if (ref == nullptr) {
+            REBLEN len = Read_Count(d);
+            map = Make_Map(len);
+            Init_Map(Alloc_Tail_Array(d->seen), map);
+
+            REBDSP dsp_orig = DSP;
+            REBLEN n;
+            for (n = 0; n < len * 2; ++n)
+                Decode_Value_Push(d, 0);
+
+            for (n = 0; n < len; ++n) {
+                Find_Map_Entry(
+                    map,
+                    DS_AT(dsp_orig + 1 + (n * 2)),
+                    SPECIFIED,
+                    DS_AT(dsp_orig + 2 + (n * 2)),
+                    SPECIFIED,
+                    true  // strict, keys were distinct when encoded
+                );
+            }
+            DS_DROP_TO(dsp_orig);
+        }
+        else if (IS_MAP(ref))
+            map = m_cast(REBMAP*, VAL_MAP(ref));
+        else
+            fail (Error_Bad_Media_Raw());
+
+        Init_Map(DS_PUSH(), map);
+        break; }
+
+      case REBIN_QUOTED: {
+        REBU64 depth = Read_Uint(d);
+        if (depth == 0 or depth > INT32_MAX)
+            fail (Error_Bad_Media_Raw());
+        Decode_Value_Push(d, REBIN_FLAG_ALLOW_NULL);
+        Quotify(DS_TOP, cast(REBLEN, depth));
+        break; }
+
+      case REBIN_MOLDED: {
+        REBSIZ size = Read_Count(d);
+        const REBYTE *utf8 = Read_Bytes(d, size);
+
+        // The scanner needs a terminated buffer, which a slice of the input
+        // is not, so it gets a copy.
+        //
+        REBBIN *bin = Make_Binary(size);
+        memcpy(BIN_HEAD(bin), utf8, size);
+        TERM_BIN_LEN(bin, size);
+        REBARR *a = Scan_UTF8_Managed(ANONYMOUS, BIN_HEAD(bin), size);
+        Free_Unmanaged_Series(bin);
+        if (ARR_LEN(a) != 1)
+            fail (Error_Bad_Media_Raw());
+        Derelativize(DS_PUSH(), ARR_HEAD(a), SPECIFIED);
+        CLEAR_CELL_FLAG(DS_TOP, NEWLINE_BEFORE);
+        break; }
+
+      default:
+        assert(false);
+        fail (Error_Bad_Media_Raw());
+    }
+
+    if (newline)
+        SET_CELL_FLAG(DS_TOP, NEWLINE_BEFORE);
+}
+
+
+//
+//  export identify-rebin?: native [
+//
+//  {Codec for identifying BINARY! data for a .REBIN file}
+//
+//      return: [logic!]
+//      data [binary!]
+//  ]
+//
+REBNATIVE(identify_rebin_q)
+{
+    REBIN_INCLUDE_PARAMS_OF_IDENTIFY_REBIN_Q;
+
+    REBSIZ size;
+    const REBYTE *bp = VAL_BINARY_SIZE_AT(&size, ARG(data));
+
+    return Init_Logic(
+        D_OUT,
+        size >= REBIN_HEADER_SIZE
+            and memcmp(bp, Rebin_Magic, sizeof(Rebin_Magic)) == 0
+    );
+}
+
+
+//
+//  export decode-rebin: native [
+//
+//  {Codec for decoding BINARY! data for a .REBIN file}
+//
+//      return: [any-value!]
+//      data [binary!]
+//  ]
+//
+REBNATIVE(decode_rebin)
+{
+    REBIN_INCLUDE_PARAMS_OF_DECODE_REBIN;
+
+    REBSIZ size;
+    const REBYTE *bp = VAL_BINARY_SIZE_AT(&size, ARG(data));
+
+    if (
+        size < REBIN_HEADER_SIZE
+        or memcmp(bp, Rebin_Magic, sizeof(Rebin_Magic)) != 0
+    ){
+        fail (Error_Bad_Media_Raw());
+    }
+    if (bp[sizeof(Rebin_Magic)] != REBIN_VERSION)
+        fail ("Unsupported REBIN format version");
+    REBYTE format_flags = bp[sizeof(Rebin_Magic) + 1];
+    if (format_flags & ~REBIN_FLAG_DEFLATE)
+        fail (Error_Bad_Media_Raw());
+
+    REBIN_DECODER d;
+    d.bp = bp + REBIN_HEADER_SIZE;
+    d.tail = bp + size;
+
+    REBYTE *inflated = nullptr;
+    if (format_flags & REBIN_FLAG_DEFLATE) {
+        REBU64 original_size = Read_Uint(&d);
+        if (original_size > INT32_MAX)
+            fail (Error_Bad_Media_Raw());
+
+        size_t inflated_size;
+        inflated = Decompress_Alloc_Core(
+            &inflated_size,
+            d.bp,
+            d.tail - d.bp,
+            cast(int, original_size),  // max, errors if it would be bigger
+            SYM_NONE  // raw deflate, the header already identifies the data
+        );
+        if (inflated_size != original_size)
+            fail (Error_Bad_Media_Raw());
+
+        d.bp = inflated;
+        d.tail = inflated + inflated_size;
+    }
+
+    REBLEN num_symbols = Read_Count(&d);
+    d.symbols = Make_Array_Core(num_symbols, NODE_FLAG_MANAGED);
+    PUSH_GC_GUARD(d.symbols);
+
+    REBLEN n;
+    for (n = 0; n < num_symbols; ++n) {
+        REBSIZ symbol_size = Read_Count(&d);
+        if (symbol_size == 0)
+            fail (Error_Bad_Media_Raw());
+        const REBYTE *utf8 = Read_Bytes(&d, symbol_size);
+        Init_Word(
+            Alloc_Tail_Array(d.symbols),
+            Intern_UTF8_Managed(utf8, symbol_size)
+        );
+    }
+
+    d.seen = Make_Array_Core(16, NODE_FLAG_MANAGED);
+    PUSH_GC_GUARD(d.seen);
+
+    Decode_Value_Push(&d, 0);
+    if (d.bp != d.tail)
+        fail (Error_Bad_Media_Raw());
+
+    Copy_Cell(D_OUT, DS_TOP);
+    CLEAR_CELL_FLAG(D_OUT, NEWLINE_BEFORE);
+    DS_DROP();
+
+    DROP_GC_GUARD(d.seen);
+    DROP_GC_GUARD(d.symbols);
+
+    if (inflated)
+        rebFree(inflated);
+
+    return D_OUT;
+}
+
+
+//
+//  export encode-rebin: native [
+//
+//  {Codec for encoding a .REBIN file}
+//
+//      return: [binary!]
+//      value [any-value!]
+//      /compress "Compress the data with DEFLATE"
+//  ]
+//
+REBNATIVE(encode_rebin)
+{
+    REBIN_INCLUDE_PARAMS_OF_ENCODE_REBIN;
+
+    REBIN_ENCODER e;
+    e.symbols = Make_Binary(64);
+    e.body = Make_Binary(256);
+    e.table_size = 64;
+    e.table = rebAllocN(struct Reb_Rebin_Entry, e.table_size);
+    memset(e.table, 0, sizeof(struct Reb_Rebin_Entry) * e.table_size);
+    e.table_used = 0;
+    e.num_symbols = 0;
+    e.num_series = 0;
+
+    Encode_Value(&e, ARG(value), 0);
+
+    REBBIN *payload = Make_Binary(
+        10 + BIN_LEN(e.symbols) + BIN_LEN(e.body)
+    );
+    Write_Uint(payload, e.num_symbols);
+    Write_Bytes(payload, BIN_HEAD(e.symbols), BIN_LEN(e.symbols));
+    Write_Bytes(payload, BIN_HEAD(e.body), BIN_LEN(e.body));
+
+    Free_Unmanaged_Series(e.symbols);
+    Free_Unmanaged_Series(e.body);
+    rebFree(e.table);
+
+    REBBIN *bin;
+    if (REF(compress)) {
+        size_t deflated_size;
+        REBYTE *deflated = Compress_Alloc_Core(
+            &deflated_size,
+            BIN_HEAD(payload),
+            BIN_LEN(payload),
+            SYM_NONE
+        );
+
+        bin = Make_Binary(REBIN_HEADER_SIZE + 10 + deflated_size);
+        Write_Bytes(bin, Rebin_Magic, sizeof(Rebin_Magic));
+        Write_Byte(bin, REBIN_VERSION);
+        Write_Byte(bin, REBIN_FLAG_DEFLATE);
+        Write_Uint(bin, BIN_LEN(payload));
+        Write_Bytes(bin, deflated, deflated_size);
+
+        rebFree(deflated);
+        Free_Unmanaged_Series(payload);
+    }
+    else {
+        bin = Make_Binary(REBIN_HEADER_SIZE + BIN_LEN(payload));
+        Write_Bytes(bin, Rebin_Magic, sizeof(Rebin_Magic));
+        Write_Byte(bin, REBIN_VERSION);
+        Write_Byte(bin, 0);
+        Write_Bytes(bin, BIN_HEAD(payload), BIN_LEN(payload));
+
+        Free_Unmanaged_Series(payload);
+    }
+
+    TERM_BIN(bin);
+    return Init_Binary(D_OUT, bin);
+}
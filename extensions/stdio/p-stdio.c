@@ -319,6 +319,7 @@ REB_R Console_Actor(REBFRM *frame_, REBVAL *port, const REBVAL *verb)
 
         UNUSED(PAR(string)); // handled in dispatcher
         UNUSED(PAR(lines)); // handled in dispatcher
+        UNUSED(PAR(map));  // only a hint
 
         // If not open, open it:
         if (not (Req(req)->flags & RRF_OPEN))
@@ -0,0 +1,121 @@
+REBOL [
+    Title: {Comparing COMPILE-FUNC To FUNC On The Same Bodies}
+    Description: {
+        COMPILE-FUNC translates bodies that fit a numeric subset into C, and
+        compiles them with TCC.  This checks that the results are the same as
+        running the body with FUNC, that errors are raised the same way, and
+        that bodies outside of the subset fall back on being a FUNC.
+    }
+]
+
+bodies: [
+    [n [integer!]] [
+        if n < 0 [return -1]
+        if n <= 1 [return n]
+        let i0: 0
+        let i1: 1
+        while [n > 1] [
+            let t: i1
+            i1: i0 + i1
+            i0: t
+            n: n - 1
+        ]
+        return i1
+    ]
+    [[-5] [0] [1] [30] [90]]
+
+    [x [decimal!] n [integer!] <local> acc] [
+        acc: 0.0
+        count-up i n [acc: acc + (x * i)]
+        either acc > 100.0 [acc / 2] [acc]
+    ]
+    [[1.5 3] [2.5 20] [-1.0 0]]
+
+    [b [binary!] return: [integer!] .sum] [
+        sum: 0
+        count-up i length of b [sum: sum + pick b i]
+        sum
+    ]
+    [[#{}] [#{010203FF}]]
+
+    [n [integer!] flag [logic!]] [
+        let k: 0
+        until [k: k + 1 (k >= n) or (flag)]
+        case [
+            even? k [k: remainder k 7]
+            true [k: negate k]
+        ]
+        k: either not flag [abs k] [max k 3]
+        to decimal! k
+    ]
+    [[10 #[false]] [9 #[false]] [5 #[true]]]
+
+    [a [decimal!] b [decimal!]] [
+        let i: 0
+        forever [
+            i: i + 1
+            if i > 10 [break]
+            if odd? i [continue]
+            a: a - b
+            repeat 3 [a: min a b]
+        ]
+        a = b
+    ]
+    [[10.0 1.0] [0.1 0.2]]
+]
+
+for-each [spec body inputs] bodies [
+    assert [func-to-c spec body]
+
+    interpreted: func spec body
+    compiled: compile-func spec body
+    for-each input inputs [
+        assert [(do compose [interpreted ((input))]) = (do compose [compiled ((input))])]
+    ]
+]
+
+; Overflow in the C is reported by asking the interpreter to do the operation
+
+overflow: compile-func [n [integer!]] [n * n]
+assert [func-to-c [n [integer!]] [n * n]]
+e: trap [overflow 9999999999]
+assert [e/id = 'overflow]
+
+; PICK out of range is NULL, as with FUNC (and using it in math is an error)
+
+assert [func-to-c [b [binary!] i [integer!]] [pick b i]]
+picker: compile-func [b [binary!] i [integer!]] [pick b i]
+assert [2 = picker #{0102} 2]
+assert [null? picker #{0102} 3]
+assert [null? picker #{0102} 0]
+adder: compile-func [b [binary!]] [1 + pick b 3]
+assert [3 = adder #{000102}]
+assert [error? trap [adder #{0102}]]
+assert [not func-to-c [b [binary!]] [let x: pick b 3 x]]  ; can't hold NULL
+
+; Calling other functions (like PRINT) isn't in the subset, so this is a FUNC
+
+assert [not func-to-c [n [integer!]] [print n]]
+assert [not func-to-c [n [integer!]] [x: n]]  ; X isn't local without /GATHER
+noisy: compile-func [n [integer!]] [print ["n is" n] n + 1]
+assert [11 = noisy 10]
+
+if not find system/options/args "nobench" [
+    spec: [n [integer!]]
+    body: [
+        let total: 0
+        count-up i n [
+            if odd? i [total: total + remainder (i * i) 7]
+        ]
+        total
+    ]
+    interpreted: func spec body
+    compiled: compile-func spec body
+
+    c: delta-time [compiled 1000000]
+    r: delta-time [interpreted 1000000]
+
+    print ["C time:" c]
+    print ["Rebol time:" r]
+    print ["Improvement:" unspaced [to integer! (r / c) "x"]]
+]
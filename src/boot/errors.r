@@ -42,6 +42,8 @@ Internal: [
     ;
     stack-overflow:     {stack overflow}
 
+    budget-exhausted:   {evaluation budget ran out (see DO/BUDGET)}
+
     not-done:           {reserved for future use (or not yet implemented)}
 
     no-memory:          [{not enough memory:} :arg1 {bytes}]
@@ -507,6 +507,7 @@ read: generic [
         [any-number!]
     /string "Convert UTF and line terminators to standard text string"
     /lines "Convert to block of strings (implies /string)"
+    /map "Hint to map a big file read-only instead of copying it, if able"
 ]
 
 write: generic [
@@ -122,6 +122,11 @@ options: make object! [  ; Options supplied to REBOL during startup
 
     dump-size: 68   ; used by dump
 
+    ; Recycle pacing (blank uses R3_GC_PACING environment variable, or 0)
+    gc-growth: _    ; % of memory in use to allocate before an auto recycle
+    gc-pause: _     ; msec a recycle may take, longer ones are spaced out
+    gc-interval: _  ; least msec of CPU time between auto recycles (4 skips max)
+
     quiet: false    ; do not show startup info (compatibility)
     about: false    ; do not show full banner (about) on start-up
     cgi: false
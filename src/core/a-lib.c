@@ -430,6 +430,21 @@ uintptr_t RL_rebTick(void)
 }
 
 
+//
+//  rebGCStats: RL_API
+//
+// The counters STATS/GC reports (recycles, mark and sweep times, nodes
+// marked and freed, bytes in each pool), as an OBJECT!.  Getting them this
+// way doesn't need the STATS function to be reachable from user context.
+//
+REBVAL *RL_rebGCStats(void)
+{
+    ENTER_API;
+
+    return Make_GC_Stats();
+}
+
+
 //=//// VALUE CONSTRUCTORS ////////////////////////////////////////////////=//
 //
 // These routines are for constructing Rebol values from C primitive types.
@@ -993,6 +1008,45 @@ REBVAL *RL_rebValueInterruptible(
     return nullptr;  // No NULLED cells in API, see notes on NULLIFY_NULLED()
 }
 
+
+//
+//  rebValueBudgeted: RL_API
+//
+// Variant of rebValue() which fails with a BUDGET-EXHAUSTED error if running
+// the code takes more than `ticks` evaluator steps, or more than `usec`
+// microseconds of CPU time.  Passing 0 for either means no limit on it.
+//
+// This gives a host running untrusted code a bound on each call, without a
+// watchdog thread to call rebHalt().  The budget is checked when the
+// evaluator checks for signals, so a single long-running native can still
+// go over it.  The evaluation can't be resumed after it fails.
+//
+REBVAL *RL_rebValueBudgeted(
+    unsigned char quotes,
+    int64_t ticks,
+    int64_t usec,
+    const void *p,
+    va_list *vaptr
+){
+    ENTER_API;
+
+    REBI64 saved_budget_tick = Eval_Budget_Tick;
+    REBI64 saved_budget_usec = Eval_Budget_Usec;
+    Tighten_Eval_Budget(ticks, usec);  // trap state restores if this fails
+
+    REBVAL *result = Alloc_Value();
+    Run_Va_May_Fail(result, quotes, p, vaptr);  // calls va_end()
+
+    Eval_Budget_Tick = saved_budget_tick;
+    Eval_Budget_Usec = saved_budget_usec;
+
+    if (not IS_NULLED(result))
+        return result;  // caller must rebRelease()
+
+    rebRelease(result);
+    return nullptr;  // No NULLED cells in API, see notes on NULLIFY_NULLED()
+}
+
 //
 //  rebElide: RL_API
 //
@@ -1766,6 +1820,7 @@ static const REBINS *rebSpliceQuoteAdjuster_internal(
                 FLAG_FLAVOR(INSTRUCTION_ADJUST_QUOTING) | NODE_FLAG_MANAGED
             );
             CLEAR_SERIES_FLAG(a, MANAGED);  // see notes above on why we lied
+            Track_Root_Array(a);  // not in manuals, but cell needs marking
             Isotopic_Quote(Copy_Cell(ARR_SINGLE(a), first));
         }
         else {  // no shortcut, push and keep going
@@ -1790,6 +1845,7 @@ static const REBINS *rebSpliceQuoteAdjuster_internal(
                 | FLAG_FLAVOR(INSTRUCTION_ADJUST_QUOTING)
         );
         CLEAR_SERIES_FLAG(a, MANAGED);  // see notes above on why we lied
+        Track_Root_Array(a);  // not in manuals, but cells need marking
 
         Free_Feed(feed);
     }
@@ -1881,6 +1937,7 @@ const void *RL_rebINLINE(const REBVAL *v)
         FLAG_FLAVOR(INSTRUCTION_SPLICE) | NODE_FLAG_MANAGED
     );
     CLEAR_SERIES_FLAG(a, MANAGED);  // lying avoided manuals tracking
+    Track_Root_Array(a);  // ...but the GC still needs to mark the cell
 
     if (IS_BLOCK(v)) {  // splice entire block contents
         Copy_Cell(ARR_SINGLE(a), v);
@@ -1930,7 +1987,9 @@ REBVAL *RL_rebManage(REBVAL *v)
     if (GET_SERIES_FLAG(a, MANAGED))
         fail ("Attempt to rebManage() a handle that's already managed.");
 
+    Untrack_Root_Array(a);
     SET_SERIES_FLAG(a, MANAGED);
+    Keep_From_Lazy_Sweep(a);
     Link_Api_Handle_To_Frame(a, FS_TOP);
 
     return v;
@@ -1967,6 +2026,7 @@ void RL_rebUnmanage(void *p)
     //
     CLEAR_SERIES_FLAG(a, MANAGED);
     Unlink_Api_Handle_From_Frame(a);
+    Track_Root_Array(a);  // no frame will mark it now
 
     TRASH_POINTER_IF_DEBUG(a->link.trash);
     TRASH_POINTER_IF_DEBUG(a->misc.trash);
@@ -542,9 +542,12 @@ void Startup_Task(void)
     Eval_Cycles = 0;
     Eval_Dose = EVAL_DOSE;
     Eval_Count = Eval_Dose;
+    Eval_Count_Skipped = 0;
     Eval_Signals = 0;
     Eval_Sigmask = ALL_BITS;
     Eval_Limit = 0;
+    Eval_Budget_Tick = 0;
+    Eval_Budget_Usec = 0;
 
     TG_Ballast = MEM_BALLAST; // or overwritten by debug build below...
     TG_Max_Ballast = MEM_BALLAST;
@@ -1050,6 +1053,7 @@ void Shutdown_Core(void)
     //
     PG_Boot_Phase = BOOT_START;
 
+    Shutdown_Profiler();
     Shutdown_Data_Stack();
 
     Shutdown_Stackoverflow();
@@ -370,8 +370,10 @@ REBNATIVE(let)
     // a weird-but-relevant name of "bindings".
     //
     REBSPC *bindings = f_specifier;
-    if (bindings and NOT_SERIES_FLAG(bindings, MANAGED))
+    if (bindings and NOT_SERIES_FLAG(bindings, MANAGED)) {
         SET_SERIES_FLAG(bindings, MANAGED);  // natives don't always manage
+        Keep_From_Lazy_Sweep(bindings);
+    }
 
     // !!! Right now what is permitted is conservative, due to things like the
     // potential confusion when someone writes:
@@ -529,8 +531,10 @@ REBNATIVE(add_let_binding) {
 
     REBFRM *f = CTX_FRAME_MAY_FAIL(VAL_CONTEXT(ARG(frame)));
 
-    if (f_specifier)
+    if (f_specifier) {
         SET_SERIES_FLAG(f_specifier, MANAGED);
+        Keep_From_Lazy_Sweep(f_specifier);
+    }
     REBSPC *patch = Make_Let_Patch(VAL_WORD_SYMBOL(ARG(word)), f_specifier);
 
     Move_Cell(ARR_SINGLE(patch), ARG(value));
@@ -562,8 +566,10 @@ REBNATIVE(add_use_object) {
 
     REBCTX *ctx = VAL_CONTEXT(ARG(object));
 
-    if (f_specifier)
+    if (f_specifier) {
         SET_SERIES_FLAG(f_specifier, MANAGED);
+        Keep_From_Lazy_Sweep(f_specifier);
+    }
     REBSPC *patch = Make_Or_Reuse_Patch(  // optimizes out CTX_LEN() == 0
         ctx,
         CTX_LEN(ctx),
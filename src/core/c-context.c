@@ -27,6 +27,54 @@
 #include "sys-core.h"
 
 
+// The side index for big keylists (see MISC_KeyHash) is keyed by the same
+// case-insensitive hash the symbol table uses, so all of a symbol's synonyms
+// hash to the same place.  That way non-strict lookups can find them all.
+// It's stored in the symbol, so nothing gets hashed again.
+//
+inline static REBLEN Hash_Key_Symbol(const REBSYM *symbol)
+  { return Symbol_Hash(symbol); }
+
+inline static void Add_Key_Hash(REBSER *hash, const REBSYM *symbol, REBLEN n)
+{
+    REBLEN mask = SER_USED(hash) - 1;
+    REBLEN *slots = SER_HEAD(REBLEN, hash);
+    REBLEN slot = Hash_Key_Symbol(symbol) & mask;
+    while (slots[slot] != 0)
+        slot = (slot + 1) & mask;
+    slots[slot] = n;
+}
+
+
+//
+//  Make_Key_Hash: C
+//
+// Build the side index for a keylist, with at most a quarter of the slots in
+// use...so keys can be appended for a while before it has to be rebuilt.
+//
+static REBSER *Make_Key_Hash(const REBSER *keylist)
+{
+    REBLEN len = SER_USED(keylist);
+    REBLEN num_slots = 64;
+    while (num_slots < len * 4)
+        num_slots *= 2;
+
+    REBSER *hash = Make_Series(
+        num_slots,
+        FLAG_FLAVOR(HASHLIST) | SERIES_FLAG_POWER_OF_2 | NODE_FLAG_MANAGED
+    );
+    Clear_Series(hash);  // all slots start as 0
+    SET_SERIES_LEN(hash, num_slots);
+
+    const REBKEY *key = SER_HEAD(const REBKEY, keylist);
+    REBLEN n;
+    for (n = 1; n <= len; ++n, ++key)
+        Add_Key_Hash(hash, KEY_SYMBOL(key), n);
+
+    return hash;
+}
+
+
 //
 //  Alloc_Context_Core: C
 //
@@ -40,6 +88,7 @@ REBCTX *Alloc_Context_Core(enum Reb_Kind kind, REBLEN capacity, REBFLGS flags)
         SERIES_MASK_KEYLIST | NODE_FLAG_MANAGED  // always shareable
     );
     mutable_LINK(Ancestor, keylist) = keylist;  // default to keylist itself
+    mutable_MISC(KeyHash, keylist) = nullptr;
     assert(SER_USED(keylist) == 0);
 
     REBARR *varlist = Make_Array_Core(
@@ -100,6 +149,8 @@ bool Expand_Context_Keylist_Core(REBCTX *context, REBLEN delta)
         else
             mutable_LINK(Ancestor, copy) = LINK(Ancestor, keylist);
 
+        mutable_MISC(KeyHash, copy) = nullptr;  // built again if needed
+
         Manage_Series(copy);
         INIT_CTX_KEYLIST_UNIQUE(context, copy);
 
@@ -166,12 +217,22 @@ REBVAL *Append_Context(
     // also check that redundant keys aren't getting added here.
     //
     EXPAND_SERIES_TAIL(keylist, 1);  // updates the used count
-    Init_Key(
-        SER_LAST(REBKEY, keylist),
-        symbol
-            ? unwrap(symbol)
-            : VAL_WORD_SYMBOL(VAL_UNESCAPED(unwrap(any_word)))
-    );
+    const REBSYM *key_symbol = symbol
+        ? unwrap(symbol)
+        : VAL_WORD_SYMBOL(VAL_UNESCAPED(unwrap(any_word)));
+    Init_Key(SER_LAST(REBKEY, keylist), key_symbol);
+
+    // Keep the key's side index up to date, if it has one.  Rather than let
+    // it get more than half full, drop it...Find_Symbol_In_Context() will
+    // make a bigger one if lookups are done.
+    //
+    REBSER *hash = MISC(KeyHash, keylist);
+    if (hash) {
+        if (SER_USED(keylist) * 2 > SER_USED(hash))
+            mutable_MISC(KeyHash, keylist) = nullptr;
+        else
+            Add_Key_Hash(hash, key_symbol, SER_USED(keylist));
+    }
 
     // Add a slot to the var list
     //
@@ -367,6 +428,7 @@ REBSER *Collect_Keylist_Managed(
             num_collected,  // no terminator
             SERIES_MASK_KEYLIST | NODE_FLAG_MANAGED
         );
+        mutable_MISC(KeyHash, keylist) = nullptr;
 
         STKVAL(*) word = DS_AT(cl->dsp_orig) + 1;
         REBKEY* key = SER_HEAD(REBKEY, keylist);
@@ -952,6 +1014,48 @@ REBLEN Find_Symbol_In_Context(
         ? ACT_PARAMS_HEAD(VAL_FRAME_PHASE(context))
         : cast_PAR(var);
 
+    REBSER *keylist = CTX_KEYLIST(c);
+    if (SER_USED(keylist) > KEYLIST_HASH_THRESHOLD) {
+        REBSER *hash = MISC(KeyHash, keylist);
+        if (not hash) {
+            hash = Make_Key_Hash(keylist);
+            mutable_MISC(KeyHash, keylist) = hash;
+        }
+
+        // All keys for synonyms of the symbol are in the run of slots that
+        // starts at its hash.  The answer is the first of the matching keys,
+        // as with the linear search (FRAME! can have duplicate keys).
+        //
+        REBLEN mask = SER_USED(hash) - 1;
+        const REBLEN *slots = SER_HEAD(REBLEN, hash);
+        REBLEN slot = Hash_Key_Symbol(symbol) & mask;
+        REBLEN first = 0;
+        REBLEN n;
+        for (; (n = slots[slot]) != 0; slot = (slot + 1) & mask) {
+            if (first != 0 and n > first)
+                continue;
+
+            const REBSYM *key_symbol = KEY_SYMBOL(key + (n - 1));
+            if (strict) {
+                if (symbol != key_symbol)
+                    continue;
+            }
+            else {
+                if (not Are_Synonyms(symbol, key_symbol))
+                    continue;
+            }
+            first = n;
+        }
+
+        if (first == 0)
+            return 0;
+
+        if (honor_hidden and Is_Param_Hidden(param + (first - 1)))
+            return 0;
+
+        return first;
+    }
+
     REBLEN n;
     for (n = 1; key != tail; ++n, ++key, ++var, ++param) {
         if (strict) {
@@ -47,6 +47,8 @@ void Snap_State_Core(struct Reb_State *s)
     s->mold_loop_tail = SER_USED(TG_Mold_Stack);
 
     s->saved_sigmask = Eval_Sigmask;
+    s->saved_budget_tick = Eval_Budget_Tick;
+    s->saved_budget_usec = Eval_Budget_Usec;
 
     // !!! Is this initialization necessary?
     s->error = NULL;
@@ -123,6 +125,8 @@ void Assert_State_Balanced_Debug(
     assert(s->mold_loop_tail == SER_USED(TG_Mold_Stack));
 
     assert(s->saved_sigmask == Eval_Sigmask);  // !!! is this always true?
+    assert(s->saved_budget_tick == Eval_Budget_Tick);
+    assert(s->saved_budget_usec == Eval_Budget_Usec);
 
     assert(s->error == NULL); // !!! necessary?
 }
@@ -185,6 +189,8 @@ void Trapped_Helper(struct Reb_State *s)
     SET_SERIES_LEN(TG_Mold_Stack, s->mold_loop_tail);
 
     Eval_Sigmask = s->saved_sigmask;
+    Eval_Budget_Tick = s->saved_budget_tick;
+    Eval_Budget_Usec = s->saved_budget_usec;
 
     TG_Jump_List = s->last_jump;
 }
@@ -552,6 +552,7 @@ REBARR *Pop_Paramlist_With_Meta_May_Fail(
         SERIES_MASK_KEYLIST | NODE_FLAG_MANAGED
     );
     mutable_LINK(Ancestor, keylist) = keylist;  // chain ends with self
+    mutable_MISC(KeyHash, keylist) = nullptr;
 
     if (flags & MKF_HAS_RETURN)
         paramlist->leader.bits |= VARLIST_FLAG_PARAMLIST_HAS_RETURN;
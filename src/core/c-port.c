@@ -145,6 +145,7 @@ REB_R Do_Port_Action(REBFRM *frame_, REBVAL *port, const REBVAL *verb)
         UNUSED(PAR(source));
         UNUSED(PAR(part));
         UNUSED(PAR(seek));
+        UNUSED(PAR(map));
 
         if (not r)
             return nullptr;  // !!! `read dns://` returns nullptr on failure
@@ -46,6 +46,86 @@
 
 #include "sys-core.h"
 
+#include <time.h>  // clock(), for time budgets
+
+
+// CPU time in microseconds.  Time the process spends blocked isn't counted,
+// so a budget only runs out on time spent evaluating (or in natives).
+//
+static REBI64 Budget_Clock_Usec(void)
+{
+    return cast(REBI64, clock()) * 1000000 / CLOCKS_PER_SEC;
+}
+
+
+//
+//  Tighten_Eval_Budget: C
+//
+// Limit evaluation from here on to `ticks` more evaluator steps and `usec`
+// more microseconds of CPU time, where 0 means no limit.  A budget that is
+// already in effect is never loosened, so code running under DO/BUDGET can't
+// give itself more room with a DO/BUDGET of its own.
+//
+// Callers save Eval_Budget_Tick and Eval_Budget_Usec beforehand and put them
+// back when the evaluation is over.  (If it fails instead, the trap state
+// restores them, see Snap_State_Core().)
+//
+void Tighten_Eval_Budget(REBI64 ticks, REBI64 usec)
+{
+    if (ticks < 0 or usec < 0)
+        fail ("Evaluation budgets can't be negative");
+
+    if (ticks != 0) {
+        REBI64 tick = Total_Eval_Cycles() + ticks;
+        if (Eval_Budget_Tick == 0 or tick < Eval_Budget_Tick)
+            Eval_Budget_Tick = tick;
+
+        // Bring the next Do_Signals_Throws() forward to when the budget
+        // ends, so the evaluator loop needs no test of its own.
+        //
+        if (Eval_Count > ticks) {
+            Eval_Cycles += ticks - Eval_Count;  // same Total_Eval_Cycles()
+            Eval_Count = ticks;
+        }
+    }
+
+    if (usec != 0) {
+        REBI64 deadline = Budget_Clock_Usec() + usec;
+        if (Eval_Budget_Usec == 0 or deadline < Eval_Budget_Usec)
+            Eval_Budget_Usec = deadline;
+    }
+}
+
+
+// Called from Do_Signals_Throws() when a budget is in effect, with the whole
+// Eval_Dose ahead.  The countdown is shortened if the budget ends sooner.
+//
+// A budget that has run out stays run out until the DO/BUDGET or API call
+// that set it is over.  The countdown is left at 1 after failing, so if the
+// code traps the error the next evaluator step fails again.
+//
+static void Check_Eval_Budget_May_Fail(void)
+{
+    if (Eval_Budget_Tick != 0) {
+        REBI64 left = Eval_Budget_Tick - Eval_Cycles;
+        if (left <= 0) {
+            Eval_Cycles += 1 - Eval_Count;
+            Eval_Count = 1;
+            fail (Error_Budget_Exhausted_Raw());
+        }
+        if (left < cast(REBI64, Eval_Count)) {
+            Eval_Cycles += left - Eval_Count;
+            Eval_Count = left;
+        }
+    }
+
+    if (Eval_Budget_Usec != 0 and Budget_Clock_Usec() >= Eval_Budget_Usec) {
+        Eval_Cycles += 1 - Eval_Count;
+        Eval_Count = 1;
+        fail (Error_Budget_Exhausted_Raw());
+    }
+}
+
 
 //
 //  Do_Signals_Throws: C
@@ -72,16 +152,22 @@
 //
 bool Do_Signals_Throws(REBVAL *out)
 {
-    // !!! When it was the case that the only way Do_Signals_Throws would run
-    // due to the Eval_Count reaching the end of an Eval_Dose, this way of
-    // doing "CPU quota" would work.  Currently, however, it is inaccurate,
-    // due to the fact that Do_Signals_Throws can be queued to run by setting
-    // the Eval_Count to 1 for a specific signal.  Review.
+    // Do_Signals_Throws can be queued to run early by setting the Eval_Count
+    // to 1 for a specific signal.  SET_SIGNAL() notes how many counts that
+    // skipped, so this still adds just the steps that were taken.
+    //
+    // (If a signal lands in the middle of the evaluator's `--Eval_Count` the
+    // store of 1 can be lost, and the countdown finishes normally.  Then the
+    // steps are undercounted by the skip--rare enough to not be worth a lock.)
     //
-    Eval_Cycles += Eval_Dose - Eval_Count;
+    Eval_Cycles += Eval_Dose - Eval_Count - Eval_Count_Skipped;
 
+    Eval_Count_Skipped = 0;
     Eval_Count = Eval_Dose;
 
+    if (Eval_Budget_Tick != 0 or Eval_Budget_Usec != 0)
+        Check_Eval_Budget_May_Fail();
+
     bool thrown = false;
 
     // The signal mask allows the system to disable processing of some
@@ -96,9 +182,34 @@ bool Do_Signals_Throws(REBVAL *out)
 
     // "Be careful of signal loops! EG: do not PRINT from here."
 
+    // The sample comes first, as the label the SIGPROF handler saw may be
+    // of a frame that's gone, and a recycle could free it.
+    //
+    if (filtered_sigs & SIG_PROFILE) {
+        CLR_SIGNAL(SIG_PROFILE);
+        Take_Profile_Sample();
+    }
+
     if (filtered_sigs & SIG_RECYCLE) {
         CLR_SIGNAL(SIG_RECYCLE);
-        Recycle();
+        if (Is_Recycle_Too_Soon()) {
+            // SYSTEM/OPTIONS/GC-INTERVAL hasn't passed, got more ballast
+        }
+        else {
+            if (GC_Lazy_Sweep)
+                Recycle_Lazy();  // SIG_SWEEP will do the sweeping
+            else
+                Recycle();
+
+            if (GC_Auto_Trim)
+                Trim_Pools(false);  // only if a pool is more than half free
+        }
+    }
+
+    if (filtered_sigs & SIG_SWEEP) {
+        CLR_SIGNAL(SIG_SWEEP);
+        if (GC_Sweep_Pending)  // a recycle may have finished it
+            Sweep_Lazily();
     }
 
 #ifdef NOT_USED_INVESTIGATE
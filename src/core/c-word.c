@@ -106,78 +106,124 @@ REBINT Get_Hash_Prime_May_Fail(REBLEN minimum)
 }
 
 
-// Removals from linear probing lists can be complex, because the same
-// overflow slot may be visited through different initial hashes:
+// The symbol table is a power-of-2 number of slots, probed linearly from
+// the slot picked by the low bits of the hash.  Each slot's hash is stored
+// in PG_Symbol_Hashes, so probes compare spellings only when the hashes
+// match, and neither expanding the table nor removing a symbol has to hash
+// any spellings again.
 //
-// http://stackoverflow.com/a/279812/211160
+// https://en.wikipedia.org/wiki/Linear_probing
 //
-// Since it's not enough to simply NULL out the spot when an interned string
-// is GC'd, a special pointer signaling "deletedness" is used.  It does not
-// cause a linear probe to terminate, but it is reused on insertions.
+// Each symbol also keeps its own hash (see Symbol_Hash()), so removing it
+// doesn't need to hash it again.
 //
-static REBSTR PG_Deleted_Symbol;
-#define DELETED_SYMBOL &PG_Deleted_Symbol
+#define Symbol_Hashes() \
+    SER_HEAD(uint32_t, PG_Symbol_Hashes)
+
+// (Making a series may sweep symbols lazily, which removes them from the
+// current table...so the new one can't be put in place until it's made.)
+//
+static REBSER *Make_Word_Table(REBSER **hashes_out, REBLEN num_slots)
+{
+    assert((num_slots & (num_slots - 1)) == 0);  // must be a power of 2
+
+    REBSER *table = Make_Series(
+        num_slots, FLAG_FLAVOR(CANONTABLE) | SERIES_FLAG_POWER_OF_2
+    );
+    Clear_Series(table);  // all slots start as nullptr
+    SET_SERIES_LEN(table, num_slots);
+
+    REBSER *hashes = Make_Series(
+        num_slots, FLAG_FLAVOR(SYMBOLHASHLIST) | SERIES_FLAG_POWER_OF_2
+    );
+    SET_SERIES_LEN(hashes, num_slots);  // only read if slot is used
+
+    *hashes_out = hashes;
+    return table;
+}
 
 
 //
 //  Expand_Word_Table: C
 //
-// Expand the hash table part of the word_table by allocating
-// the next larger table size and rehashing all the words of
-// the current table.  Free the old hash array.
+// Double the size of the symbol table, and move all the symbols over to it
+// using their stored hashes.  Free the old one.
 //
 static void Expand_Word_Table(void)
 {
-    // The only full list of symbol words available is the old hash table.
-    // Hold onto it while creating the new hash table.
-
     REBLEN old_num_slots = SER_USED(PG_Symbols_By_Hash);
-    REBSTR* *old_symbols_by_hash = SER_HEAD(REBSTR*, PG_Symbols_By_Hash);
+    if (old_num_slots > UINT32_MAX / 2) {
+        DECLARE_LOCAL (temp);
+        Init_Integer(temp, old_num_slots);
+        fail (Error_Size_Limit_Raw(temp));
+    }
 
-    REBLEN num_slots = Get_Hash_Prime_May_Fail(old_num_slots + 1);
-    assert(SER_WIDE(PG_Symbols_By_Hash) == sizeof(REBSTR*));
+    REBSER *hashes;
+    REBSER *table = Make_Word_Table(&hashes, old_num_slots * 2);
 
-    REBSER *ser = Make_Series(
-        num_slots, FLAG_FLAVOR(CANONTABLE) | SERIES_FLAG_POWER_OF_2
-    );
-    Clear_Series(ser);
-    SET_SERIES_LEN(ser, num_slots);
+    REBSER *old_table = PG_Symbols_By_Hash;
+    REBSER *old_hashes = PG_Symbol_Hashes;
+    REBSYM* *old_symbols_by_hash = SER_HEAD(REBSYM*, old_table);
+    uint32_t *old_symbol_hashes = SER_HEAD(uint32_t, old_hashes);
 
-    // Rehash all the symbols:
+    PG_Symbols_By_Hash = table;
+    PG_Symbol_Hashes = hashes;
 
-    REBSTR **new_symbols_by_hash = SER_HEAD(REBSTR*, ser);
+    REBLEN mask = SER_USED(PG_Symbols_By_Hash) - 1;
+    REBSYM* *symbols_by_hash = SER_HEAD(REBSYM*, PG_Symbols_By_Hash);
+    uint32_t *symbol_hashes = Symbol_Hashes();
 
     REBLEN old_slot;
     for (old_slot = 0; old_slot != old_num_slots; ++old_slot) {
-        REBSTR *symbol = old_symbols_by_hash[old_slot];
+        REBSYM *symbol = old_symbols_by_hash[old_slot];
         if (not symbol)
             continue;
 
-        if (symbol == DELETED_SYMBOL) {  // clean out deleted symbol entries
-            --PG_Num_Symbol_Slots_In_Use;
-          #if !defined(NDEBUG)
-            --PG_Num_Symbol_Deleteds;  // keep track for shutdown assert
-          #endif
-            continue;
-        }
-
-        REBLEN skip;
-        REBLEN slot = First_Hash_Candidate_Slot(
-            &skip,
-            Hash_String(symbol),
-            num_slots
-        );
+        uint32_t hash = old_symbol_hashes[old_slot];
+        REBLEN slot = hash & mask;
+        while (symbols_by_hash[slot])  // skip occupied slots
+            slot = (slot + 1) & mask;
 
-        while (new_symbols_by_hash[slot]) {  // skip occupied slots
-            slot += skip;
-            if (slot >= num_slots)
-                slot -= num_slots;
-        }
-        new_symbols_by_hash[slot] = symbol;
+        symbols_by_hash[slot] = symbol;
+        symbol_hashes[slot] = hash;
     }
 
-    Free_Unmanaged_Series(PG_Symbols_By_Hash);
-    PG_Symbols_By_Hash = ser;
+    Free_Unmanaged_Series(old_table);
+    Free_Unmanaged_Series(old_hashes);
+}
+
+
+// Find the slot for a spelling, or the NULL slot where a search for it ends
+// (and any synonym found along the way, with a > 0 Compare_UTF8() result).
+//
+// All spellings are in the table, and those that differ only in case have
+// the same hash.  So the spellings are only compared if the hashes match.
+//
+static REBLEN Probe_Word_Table(
+    REBSYM **synonym_out,
+    uint32_t hash,
+    const REBYTE *utf8,
+    size_t size
+){
+    REBSYM* *symbols_by_hash = SER_HEAD(REBSYM*, PG_Symbols_By_Hash);
+    uint32_t *symbol_hashes = Symbol_Hashes();
+    REBLEN mask = SER_USED(PG_Symbols_By_Hash) - 1;
+
+    *synonym_out = nullptr;
+
+    REBLEN slot = hash & mask;
+    REBSYM *symbol;
+    for (; (symbol = symbols_by_hash[slot]); slot = (slot + 1) & mask) {
+        if (symbol_hashes[slot] != hash)
+            continue;  // can't be the same spelling, in any casing
+
+        REBINT cmp = Compare_UTF8(STR_HEAD(symbol), utf8, size);
+        if (cmp == 0)
+            return slot;  // was a case-sensitive match
+        if (cmp > 0)
+            *synonym_out = symbol;  // alternate casing, not a match
+    }
+    return slot;
 }
 
 
@@ -198,72 +244,31 @@ static void Expand_Word_Table(void)
 //
 const REBSYM *Intern_UTF8_Managed(const REBYTE *utf8, size_t size)
 {
-    // The hashing technique used is called "linear probing":
-    //
-    // https://en.wikipedia.org/wiki/Linear_probing
+    // For the search to be guaranteed to terminate, there must be a NULL
+    // slot to find on a miss.  The table is kept at most half full, and is
+    // checked for expansion *before* the search.
     //
-    // For the hash search to be guaranteed to terminate, the table must be
-    // large enough that we are able to find a NULL if there's a miss.  (It's
-    // actually kept larger than that, but to be on the right side of theory,
-    // the table is always checked for expansion needs *before* the search.)
-    //
-    REBLEN num_slots = SER_USED(PG_Symbols_By_Hash);
-    if (PG_Num_Symbol_Slots_In_Use > num_slots / 2) {
+    if ((PG_Num_Symbol_Slots_In_Use + 1) * 2 > SER_USED(PG_Symbols_By_Hash))
         Expand_Word_Table();
-        num_slots = SER_USED(PG_Symbols_By_Hash);  // got larger
-    }
-
-    REBSYM* *symbols_by_hash = SER_HEAD(REBSYM*, PG_Symbols_By_Hash);
-
-    REBLEN skip; // how many slots to skip when occupied candidates found
-    REBLEN slot = First_Hash_Candidate_Slot(
-        &skip,
-        Hash_Scan_UTF8_Caseless_May_Fail(utf8, size),
-        num_slots
-    );
-
-    // The hash table only indexes the canon form of each spelling.  So when
-    // testing a slot to see if it's a match (or a collision that needs to
-    // be skipped to try again) the search uses a comparison that is
-    // case-insensitive...but reports if synonyms via > 0 results.
-    //
-    REBSYM *synonym = nullptr;
-    REBSYM **deleted_slot = nullptr;
-    REBSYM* symbol;
-    while ((symbol = symbols_by_hash[slot])) {
-        if (symbol == DELETED_SYMBOL) {
-            deleted_slot = &symbols_by_hash[slot];
-            goto next_candidate_slot;
-        }
 
-      blockscope {
-        REBINT cmp = Compare_UTF8(STR_HEAD(symbol), utf8, size);
-        if (cmp == 0)
-            return symbol;  // was a case-sensitive match
-        if (cmp < 0)
-            goto next_candidate_slot;  // wasn't an alternate casing
-
-        // The > 0 result means that the canon word that was found is an
-        // alternate casing ("synonym") for the string we're interning.  The
-        // synonyms are attached to the canon form with a circular list.
-        //
-        synonym = symbol;  // save for linking into synonyms list
-        goto next_candidate_slot;
-      }
-
-        goto new_interning;  // no synonym matched, make new synonym for canon
+    uint32_t hash = Hash_Spelling_May_Fail(utf8, size);
 
-      next_candidate_slot:  // https://en.wikipedia.org/wiki/Linear_probing
+    REBSYM *synonym;
+    REBLEN slot = Probe_Word_Table(&synonym, hash, utf8, size);
 
-        slot += skip;
-        if (slot >= num_slots)
-            slot -= num_slots;
+    REBSYM *symbol = *SER_AT(REBSYM*, PG_Symbols_By_Hash, slot);
+    if (symbol) {
+        Keep_From_Lazy_Sweep(symbol);  // may be garbage not yet swept
+        return symbol;
     }
 
-  new_interning: {
-
+    // The hash after the terminator costs the spellings that would have just
+    // fit in the node their inline storage: 12 to 15 bytes when a cell is
+    // 16 bytes, 28 to 31 when it's 32.  Those get a dynamic allocation.  The
+    // node has no spare field on 32-bit platforms to put the hash in instead.
+    //
     REBBIN *s = BIN(Make_Series(
-        size + 1,  // if small, fits in a REBSER node (w/no data allocation)
+        size + 1 + sizeof(hash),  // if small, fits in a REBSER node
         FLAG_FLAVOR(SYMBOL) | SERIES_FLAG_FIXED_SIZE
     ));
 
@@ -272,6 +277,13 @@ const REBSYM *Intern_UTF8_Managed(const REBYTE *utf8, size_t size)
     //
     memcpy(BIN_HEAD(s), utf8, size);
     TERM_BIN_LEN(s, size);
+    memcpy(BIN_AT(s, size + 1), &hash, sizeof(hash));  // see Symbol_Hash()
+
+    // Making the series may have swept symbols lazily, which rearranges the
+    // table (and may have freed the synonym), so search again.
+    //
+    slot = Probe_Word_Table(&synonym, hash, utf8, size);
+    assert(*SER_AT(REBSYM*, PG_Symbols_By_Hash, slot) == nullptr);
 
     // The UTF-8 series can be aliased with AS to become an ANY-STRING! or a
     // BINARY!.  If it is, then it should not be modified.
@@ -322,23 +334,15 @@ const REBSYM *Intern_UTF8_Managed(const REBYTE *utf8, size_t size)
     s->misc.bind_index.high = 0;
     s->misc.bind_index.low = 0;
 
-    if (deleted_slot) {
-        *deleted_slot = SYM(s);  // reuse the deleted slot
-      #if !defined(NDEBUG)
-        --PG_Num_Symbol_Deleteds;  // note slot usage count stays constant
-      #endif
-    }
-    else {
-        symbols_by_hash[slot] = SYM(s);
-        ++PG_Num_Symbol_Slots_In_Use;
-    }
+    *SER_AT(REBSYM*, PG_Symbols_By_Hash, slot) = SYM(s);
+    *SER_AT(uint32_t, PG_Symbol_Hashes, slot) = hash;
+    ++PG_Num_Symbol_Slots_In_Use;
 
     // Created series must be managed, because if they were not there could
     // be no clear contract on the return result--as it wouldn't be possible
     // to know if a shared instance had been managed by someone else or not.
     //
     return SYM(Manage_Series(s));
-  }
 }
 
 
@@ -390,46 +394,40 @@ void GC_Kill_Interning(REBSTR *intern)
     assert(intern->misc.bind_index.high == 0);  // shouldn't GC during binds?
     assert(intern->misc.bind_index.low == 0);
 
-    REBLEN num_slots = SER_USED(PG_Symbols_By_Hash);
+    REBLEN mask = SER_USED(PG_Symbols_By_Hash) - 1;
     REBSTR* *symbols_by_hash = SER_HEAD(REBSTR*, PG_Symbols_By_Hash);
+    uint32_t *symbol_hashes = Symbol_Hashes();
 
-    REBLEN skip;
-    REBLEN slot = First_Hash_Candidate_Slot(
-        &skip,
-        Hash_String(intern),
-        num_slots
-    );
-
-    // We *will* find the canon form in the hash table.
+    // We *will* find the spelling in the hash table.
     //
-    while (symbols_by_hash[slot] != intern) {
-        slot += skip;
-        if (slot >= num_slots)
-            slot -= num_slots;
-    }
-
-    // This canon form must be removed from the hash table.  Ripple the
-    // collision slots back until a NULL is found, to reduce search times.
-    //
-    REBLEN previous_slot = slot;
-    while (symbols_by_hash[slot]) {
-        slot += skip;
-        if (slot >= num_slots)
-            slot -= num_slots;
-        symbols_by_hash[previous_slot] = symbols_by_hash[slot];
-    }
-
-    // Signal that the hash slot is "deleted" via a special pointer.
-    // See notes on DELETED_SLOT for why the final slot in the collision
-    // chain can't just be left NULL:
+    REBLEN slot = Symbol_Hash(SYM(intern)) & mask;
+    while (symbols_by_hash[slot] != intern)
+        slot = (slot + 1) & mask;
+
+    // Removing it can't just leave the slot NULL, as that would end probes
+    // for symbols further along that went past it.  Instead, move back any
+    // symbol that can be found from the emptied slot, and so on until a
+    // NULL is reached (so no "deleted" markers are needed):
     //
-    // http://stackoverflow.com/a/279812/211160
+    // https://en.wikipedia.org/wiki/Linear_probing#Deletion
     //
-    symbols_by_hash[previous_slot] = DELETED_SYMBOL;
+    REBLEN hole = slot;
+    while (true) {
+        slot = (slot + 1) & mask;
+        if (not symbols_by_hash[slot])
+            break;
+
+        REBLEN home = symbol_hashes[slot] & mask;  // where its probe starts
+        if (((slot - home) & mask) < ((slot - hole) & mask))
+            continue;  // probe for it doesn't pass through the hole
+
+        symbols_by_hash[hole] = symbols_by_hash[slot];
+        symbol_hashes[hole] = symbol_hashes[slot];
+        hole = slot;
+    }
+    symbols_by_hash[hole] = nullptr;
 
-  #if !defined(NDEBUG)
-    ++PG_Num_Symbol_Deleteds;  // total use same (PG_Num_Symbols_Or_Deleteds)
-  #endif
+    --PG_Num_Symbol_Slots_In_Use;
 }
 
 
@@ -446,33 +444,20 @@ void GC_Kill_Interning(REBSTR *intern)
 void Startup_Interning(void)
 {
     PG_Num_Symbol_Slots_In_Use = 0;
-  #if !defined(NDEBUG)
-    PG_Num_Symbol_Deleteds = 0;
-  #endif
 
-    // Start hash table out at a fixed size.  When collisions occur, it
-    // causes a skipping pattern that continues until it finds the desired
-    // slot.  The method is known as linear probing:
-    //
-    // https://en.wikipedia.org/wiki/Linear_probing
+    // The table must always be bigger than the total number of words, so
+    // there's a NULL slot for a search to end on.  But to keep the probes
+    // short, it should be significantly larger than that.  R3-Alpha used a
+    // heuristic of 4 times as big as the number of words.
     //
-    // It must always be at least as big as the total number of words, in order
-    // for it to uniquely be able to locate each symbol pointer.  But to
-    // reduce long probing chains, it should be significantly larger than that.
-    // R3-Alpha used a heuristic of 4 times as big as the number of words.
-
     REBLEN n;
   #if defined(NDEBUG)
-    n = Get_Hash_Prime_May_Fail(WORD_TABLE_SIZE * 4);  // *4 reduces rehashing
+    n = WORD_TABLE_SIZE * 4;  // *4 reduces rehashing
   #else
     n = 1; // forces exercise of rehashing logic in debug build
   #endif
 
-    PG_Symbols_By_Hash = Make_Series(
-        n, FLAG_FLAVOR(CANONTABLE) | SERIES_FLAG_POWER_OF_2
-    );
-    Clear_Series(PG_Symbols_By_Hash);  // all slots start as nullptr
-    SET_SERIES_LEN(PG_Symbols_By_Hash, n);
+    PG_Symbols_By_Hash = Make_Word_Table(&PG_Symbol_Hashes, n);
 }
 
 
@@ -629,7 +614,7 @@ void Shutdown_Symbols(void)
 void Shutdown_Interning(void)
 {
   #if !defined(NDEBUG)
-    if (PG_Num_Symbol_Slots_In_Use - PG_Num_Symbol_Deleteds != 0) {
+    if (PG_Num_Symbol_Slots_In_Use != 0) {
         //
         // !!! There needs to be a more user-friendly output for this,
         // and to detect if it really was an API problem or something else
@@ -638,7 +623,7 @@ void Shutdown_Interning(void)
         //
         printf(
             "!!! %d leaked canons found in shutdown\n",
-            cast(int, PG_Num_Symbol_Slots_In_Use - PG_Num_Symbol_Deleteds)
+            cast(int, PG_Num_Symbol_Slots_In_Use)
         );
         printf("!!! LIKELY rebUnmanage() without a rebRelease() in API\n");
 
@@ -647,11 +632,12 @@ void Shutdown_Interning(void)
         REBLEN slot;
         for (slot = 0; slot < SER_USED(PG_Symbols_By_Hash); ++slot) {
             REBSTR *symbol = *SER_AT(REBSTR*, PG_Symbols_By_Hash, slot);
-            if (symbol and symbol != DELETED_SYMBOL)
+            if (symbol)
                 panic (symbol);
         }
     }
   #endif
 
     Free_Unmanaged_Series(PG_Symbols_By_Hash);
+    Free_Unmanaged_Series(PG_Symbol_Hashes);
 }
@@ -38,6 +38,8 @@
 //      /show "Print formatted results to console"
 //      /profile "Returns profiler object"
 //      /evals "Number of values evaluated by interpreter"
+//      /pacing "Recycle pacing settings and what they last decided"
+//      /gc "Recycle counts, pause times, nodes marked and freed, pool bytes"
 //      /pool "Dump all series in pool"
 //          [integer!]
 //  ]
@@ -46,11 +48,26 @@ REBNATIVE(stats)
 {
     INCLUDE_PARAMS_OF_STATS;
 
-    REBI64 num_evals = Eval_Cycles + Eval_Dose - Eval_Count;
+    REBI64 num_evals = Total_Eval_Cycles();
 
     if (REF(evals))
         return Init_Integer(D_OUT, num_evals);
 
+    if (REF(pacing)) {
+        return rebValue("make object! [",
+            "growth:", rebI(Get_GC_Pacing(OPTIONS_GC_GROWTH)),
+            "pause:", rebI(Get_GC_Pacing(OPTIONS_GC_PAUSE)),
+            "interval:", rebI(Get_GC_Pacing(OPTIONS_GC_INTERVAL)),
+            "ballast:", rebI(GC_Paced_Ballast),
+            "decision: to word!", rebT(GC_Pace_Decision),
+            "last-pause:", rebI(GC_Last_Pause),  // microseconds
+            "deferred:", rebI(GC_Deferred),
+        "]");
+    }
+
+    if (REF(gc))
+        return Make_GC_Stats();
+
     if (REF(profile)) {
       #if defined(DEBUG_COLLECT_STATS)
         return rebValue("make object! [",
@@ -89,6 +106,67 @@ REBNATIVE(stats)
 }
 
 
+//
+//  Make_GC_Stats: C
+//
+// The counters in GC_Stats as an OBJECT!, for STATS/GC and rebGCStats().
+// Times are CPU time in microseconds.  PAUSES counts recycles that took
+// less than 100us, 1ms, 10ms, 100ms, 1s, and longer.  POOLS has a block of
+// [unit-size used-bytes allocated-bytes] for each pool, and OTHER-BYTES is
+// the rest of the memory in use (e.g. series data too big for the pools).
+//
+// The pool bytes are counted when asked for, not kept up to date, so they
+// may reflect a recycle that happens while this is building the object.
+//
+REBVAL *Make_GC_Stats(void)
+{
+    REB_GC_STATS gc = GC_Stats;  // making the object may recycle
+
+    REBVAL *pauses = rebValue("copy []");
+    REBLEN i;
+    for (i = 0; i < GC_PAUSE_BUCKETS; ++i)
+        rebElide("append", pauses, rebI(gc.Pauses[i]));
+
+    REBVAL *pools = rebValue("copy []");
+    REBI64 pooled = 0;
+    for (i = 0; i < SYSTEM_POOL; ++i) {
+        REBPOL *pool = &Mem_Pools[i];
+
+        REBI64 allocated = 0;
+        REBSEG *seg;
+        for (seg = pool->segs; seg; seg = seg->next)
+            allocated += seg->size;
+        pooled += allocated;
+
+        rebElide("append/only", pools, "reduce [",
+            rebI(pool->wide),
+            rebI(cast(REBI64, pool->has - pool->free) * pool->wide),
+            rebI(allocated),
+        "]");
+    }
+
+    REBVAL *stats = rebValue("make object! [",
+        "recycles:", rebI(gc.Recycles),
+        "mark-usec:", rebI(gc.Mark_Usec),
+        "sweep-usec:", rebI(gc.Sweep_Usec),
+        "last-mark-usec:", rebI(gc.Last_Mark_Usec),
+        "last-sweep-usec:", rebI(gc.Last_Sweep_Usec),
+        "max-pause-usec:", rebI(gc.Max_Pause_Usec),
+        "pauses:", pauses,
+        "marked:", rebI(gc.Marked),
+        "freed:", rebI(gc.Freed),
+        "last-marked:", rebI(gc.Last_Marked),
+        "last-freed:", rebI(gc.Last_Freed),
+        "pools:", pools,
+        "other-bytes:", rebI(cast(REBI64, PG_Mem_Usage) - pooled),
+    "]");
+
+    rebRelease(pauses);
+    rebRelease(pools);
+    return stats;
+}
+
+
 #if defined(INCLUDE_CALLGRIND_NATIVE)
     #include <valgrind/callgrind.h>
 #endif
@@ -146,3 +224,281 @@ REBNATIVE(callgrind)
     fail ("This executable wasn't compiled with INCLUDE_CALLGRIND_NATIVE");
   #endif
 }
+
+
+#if defined(SAMPLING_PROFILER)
+    #include <signal.h>
+    #include <sys/time.h>  // for setitimer()
+
+    // The sample can't be taken here, as that allocates.  But the action
+    // running now is noted, so time in a long-running native is charged to
+    // it and not to whatever runs after it.  This only reads the frames and
+    // writes two pointers, which is safe wherever the signal interrupts.
+    //
+    static void Handle_Profile_Signal(int sig)
+    {
+        UNUSED(sig);
+
+        REBFRM *f = FS_TOP;
+        for (; f != FS_BOTTOM; f = f->prior) {
+            if (Is_Action_Frame(f) and f->key == f->key_tail)
+                break;  // not fulfilling arguments (asserts aren't safe)
+        }
+        PG_Profile_Frame = f;
+        PG_Profile_Label = (f == FS_BOTTOM) ? nullptr : try_unwrap(f->label);
+
+        SET_SIGNAL(SIG_PROFILE);
+    }
+#endif
+
+
+inline static void Append_Profile_Label(
+    REBSTR *buf,
+    option(const REBSTR*) label
+){
+    if (label)
+        Append_Spelling(buf, unwrap(label));
+    else
+        Append_Ascii(buf, "(anonymous)");
+}
+
+
+// Action frames from `f` down that have finished gathering their arguments
+// are written root-first as `label file:line` (the place they were called
+// from), separated by semicolons.  If `returned`, the label of an action that
+// is no longer running goes last.  This is the "folded stacks" format of
+// flamegraph.pl, and each distinct stack is counted in PG_Profile_Samples.
+//
+static void Record_Profile_Sample(
+    REBFRM *f,
+    bool returned,
+    option(const REBSYM*) label
+){
+    REBDSP dsp_orig = DSP;
+
+    for (; f != FS_BOTTOM; f = f->prior) {
+        if (not Is_Action_Frame(f) or Is_Action_Frame_Fulfilling(f))
+            continue;
+        Init_Handle_Cdata(DS_PUSH(), f, 1);
+    }
+
+    DECLARE_MOLD (mo);
+    Push_Mold(mo);
+
+    for (; DSP != dsp_orig; DS_DROP()) {  // pushed leaf first, so pops root
+        f = cast(REBFRM*, VAL_HANDLE_VOID_POINTER(DS_TOP));
+
+        if (STR_SIZE(mo->series) != mo->offset)
+            Append_Codepoint(mo->series, ';');
+
+        Append_Profile_Label(mo->series, FRM_LABEL(f));
+
+        const REBSTR *file = FRM_FILE(f);
+        if (file) {
+            Append_Codepoint(mo->series, ' ');
+            Append_Spelling(mo->series, file);
+            Append_Codepoint(mo->series, ':');
+            Append_Int(mo->series, FRM_LINE(f));
+        }
+    }
+
+    if (returned) {
+        if (STR_SIZE(mo->series) != mo->offset)
+            Append_Codepoint(mo->series, ';');
+        Append_Profile_Label(mo->series, label);
+    }
+
+    if (STR_SIZE(mo->series) == mo->offset)
+        Append_Ascii(mo->series, "(top)");  // no action running, e.g. boot
+
+    Init_Text(DS_PUSH(), Pop_Molded_String(mo));
+
+    REBMAP *map = VAL_MAP_KNOWN_MUTABLE(PG_Profile_Samples);  // write barrier
+    REBLEN n = Find_Map_Entry(map, DS_TOP, SPECIFIED, nullptr, SPECIFIED, true);
+    if (n) {
+        RELVAL *count = ARR_AT(MAP_PAIRLIST(map), ((n - 1) * 2) + 1);
+        ++VAL_INT64(count);
+    }
+    else {
+        DECLARE_LOCAL (one);
+        Init_Integer(one, 1);
+        Find_Map_Entry(map, DS_TOP, SPECIFIED, one, SPECIFIED, true);
+    }
+    DS_DROP();
+
+    ++PG_Profile_Sample_Count;
+}
+
+
+//
+//  Take_Profile_Sample: C
+//
+// Called by Do_Signals_Throws() when the SIGPROF timer has gone off.  If the
+// action that was running then is still on the stack, nothing under it has
+// changed, so the sample is taken from there.  Otherwise it returned before
+// the evaluator got control back: the stack it returned to is sampled, with
+// its label on top.  (The frame pointer is only compared, never followed.  A
+// new frame at the same address could be taken for it, blurring a sample.)
+//
+void Take_Profile_Sample(void)
+{
+    if (not PG_Profiling)
+        return;  // a SIGPROF that was pending when PROFILE/STOP ran
+
+    REBFRM *sampled = PG_Profile_Frame;
+    const REBSYM *label = PG_Profile_Label;
+
+    REBFRM *f = FS_TOP;
+    while (f != sampled and f != FS_BOTTOM)
+        f = f->prior;
+
+    if (f == sampled)
+        Record_Profile_Sample(sampled, false, nullptr);
+    else
+        Record_Profile_Sample(FS_TOP, true, label);
+}
+
+
+//
+//  Stop_Profiler: C
+//
+static void Stop_Profiler(void)
+{
+  #if defined(SAMPLING_PROFILER)
+    struct itimerval off;
+    memset(&off, 0, sizeof(off));
+    setitimer(ITIMER_PROF, &off, nullptr);
+    signal(SIGPROF, SIG_DFL);
+  #endif
+
+    PG_Profiling = false;
+    CLR_SIGNAL(SIG_PROFILE);
+}
+
+
+//
+//  Shutdown_Profiler: C
+//
+void Shutdown_Profiler(void)
+{
+    if (PG_Profiling)
+        Stop_Profiler();
+
+    if (PG_Profile_Samples) {
+        rebRelease(PG_Profile_Samples);
+        PG_Profile_Samples = nullptr;
+    }
+}
+
+
+//
+//  profile: native [
+//
+//  {Sample which Rebol functions are running, for making flame graphs}
+//
+//      return: [<opt> integer! text!]
+//      /start "Begin sampling on a CPU time interval, discarding old samples"
+//      /interval "Microseconds of CPU time between samples (default 1000)"
+//          [integer!] {0 for no timer, so only PROFILE/SAMPLE takes samples}
+//      /sample "Take a sample of the stack here, return the sample count"
+//      /stop "Stop sampling and return how many samples were taken"
+//      /report "Get the samples as folded stacks, `a;b;c count` per line"
+//  ]
+//
+REBNATIVE(profile)
+//
+// Samples are taken at the next evaluator step after each SIGPROF, so they
+// work the same in release builds.  To make an SVG, write the report to a
+// file and give it to flamegraph.pl:
+//
+//     profile/start
+//     do %script.r
+//     profile/stop
+//     write %out.folded profile/report
+//
+//     flamegraph.pl out.folded > out.svg
+{
+    INCLUDE_PARAMS_OF_PROFILE;
+
+    if (REF(start)) {
+        REBI64 usecs = REF(interval) ? VAL_INT64(ARG(interval)) : 1000;
+        if (usecs < 0 or usecs >= 1000000)
+            fail (PAR(interval));
+
+      #if !defined(SAMPLING_PROFILER)
+        if (usecs != 0)
+            fail ("PROFILE needs SIGPROF, which this platform doesn't have");
+      #endif
+
+        if (PG_Profiling)
+            Stop_Profiler();
+
+        if (PG_Profile_Samples)
+            rebRelease(PG_Profile_Samples);
+        PG_Profile_Samples = Init_Map(Alloc_Value(), Make_Map(64));
+        rebUnmanage(PG_Profile_Samples);
+        PG_Profile_Sample_Count = 0;
+
+        PG_Profiling = true;
+
+      #if defined(SAMPLING_PROFILER)
+        if (usecs != 0) {
+            struct sigaction action;
+            action.sa_handler = &Handle_Profile_Signal;
+            sigemptyset(&action.sa_mask);
+            action.sa_flags = SA_RESTART;  // don't make I/O fail w/EINTR
+            sigaction(SIGPROF, &action, nullptr);
+
+            struct itimerval timer;
+            timer.it_interval.tv_sec = 0;
+            timer.it_interval.tv_usec = usecs;
+            timer.it_value = timer.it_interval;
+            setitimer(ITIMER_PROF, &timer, nullptr);
+        }
+      #endif
+
+        return Init_Integer(D_OUT, usecs);
+    }
+
+    if (REF(interval))
+        fail ("PROFILE/INTERVAL only applies with /START");
+
+    if (REF(sample)) {
+        if (not PG_Profiling)
+            fail ("PROFILE/SAMPLE needs PROFILE/START first");
+        Record_Profile_Sample(FS_TOP, false, nullptr);
+        return Init_Integer(D_OUT, PG_Profile_Sample_Count);
+    }
+
+    if (REF(stop)) {
+        if (PG_Profiling)
+            Stop_Profiler();
+        return Init_Integer(D_OUT, PG_Profile_Sample_Count);
+    }
+
+    if (REF(report)) {
+        if (not PG_Profile_Samples)
+            return nullptr;  // PROFILE/START was never run
+
+        DECLARE_MOLD (mo);
+        Push_Mold(mo);
+
+        const REBARR *pairlist = MAP_PAIRLIST(VAL_MAP(PG_Profile_Samples));
+        const RELVAL *tail = ARR_TAIL(pairlist);
+        const RELVAL *key = ARR_HEAD(pairlist);
+        for (; key != tail; key += 2) {
+            Append_String(mo->series, key);
+            Append_Codepoint(mo->series, ' ');
+
+            REBYTE buf[MAX_NUM_LEN + 1];
+            Form_Int_Len(buf, VAL_INT64(key + 1), MAX_NUM_LEN);
+            Append_Ascii(mo->series, s_cast(buf));
+
+            Append_Codepoint(mo->series, '\n');
+        }
+
+        return Init_Text(D_OUT, Pop_Molded_String(mo));
+    }
+
+    fail ("PROFILE needs /START, /SAMPLE, /STOP, or /REPORT");
+}
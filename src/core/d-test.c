@@ -31,6 +31,17 @@
 #include "sys-core.h"
 
 
+#if defined(INCLUDE_TEST_LIBREBOL_NATIVE)
+
+static REBVAL *Budgeted_Forever_Dangerous(void *opaque)
+{
+    UNUSED(opaque);
+    return rebValueBudgeted(1000, 0, "forever [1 + 2]");  // should fail
+}
+
+#endif
+
+
 //
 //  test-librebol: native [
 //
@@ -82,6 +93,17 @@ REBNATIVE(test_librebol)
     SET_CELL_FLAG(Init_Integer(DS_PUSH(), 5), NEWLINE_BEFORE);
     Init_Logic(DS_PUSH(), rebDid("null?", nullptr));
 
+    SET_CELL_FLAG(Init_Integer(DS_PUSH(), 6), NEWLINE_BEFORE);
+    REBVAL *budgeted = rebValueBudgeted(1000, 0, "1 +", rebI(2));
+    Init_Logic(DS_PUSH(), rebDid("3 =", rebR(budgeted)));
+
+    SET_CELL_FLAG(Init_Integer(DS_PUSH(), 7), NEWLINE_BEFORE);
+    REBVAL *error = rebRescue(&Budgeted_Forever_Dangerous, nullptr);
+    Init_Logic(
+        DS_PUSH(),
+        rebDid("'budget-exhausted = pick", rebR(error), "'id")
+    );
+
     rebRelease(macro);
 
     return Init_Block(D_OUT, Pop_Stack_Values(dsp_orig));
@@ -89,6 +111,153 @@ REBNATIVE(test_librebol)
 }
 
 
+#if defined(NODE_MAGAZINES)
+
+#include <pthread.h>
+#include <time.h>
+
+struct Reb_Alloc_Bench {
+    pthread_t thread;
+    REBLEN count;  // how many units this thread allocates (and frees)
+    bool ok;
+};
+
+static void *Alloc_Bench_Thread(void *param)
+{
+    struct Reb_Alloc_Bench *b = cast(struct Reb_Alloc_Bench*, param);
+
+    REBPLU *batch[100];
+    REBLEN left = b->count;
+    while (left != 0) {
+        REBLEN n = MIN(left, 100);
+        REBLEN i;
+        for (i = 0; i < n; ++i) {
+            batch[i] = cast(REBPLU*, Try_Alloc_Node(SER_POOL));
+            if (not batch[i])
+                break;
+            mutable_FIRST_BYTE(batch[i]->headspot) = NODE_BYTEMASK_0x80_NODE
+                | NODE_BYTEMASK_0x01_CELL;  // so a sweep would skip it
+        }
+        b->ok = (i == n);
+        while (i != 0)
+            Free_Node(SER_POOL, cast(REBNOD*, batch[--i]));
+        if (not b->ok)
+            break;
+        left -= n;
+    }
+
+    Flush_Magazines();  // units in this thread's magazines would be lost
+    return nullptr;
+}
+
+#endif
+
+
+//
+//  node-alloc-benchmark: native [
+//
+//  "Measure node allocation throughput as threads are added"
+//
+//      return: [block!]
+//          {Pairs of thread count and allocations per second}
+//      threads "Largest thread count to try (tries 1, 2, 4...)"
+//          [integer!]
+//      count "Units each thread allocates and frees"
+//          [integer!]
+//  ]
+//
+REBNATIVE(node_alloc_benchmark)
+{
+    INCLUDE_PARAMS_OF_NODE_ALLOC_BENCHMARK;
+
+  #if !defined(NODE_MAGAZINES)
+    UNUSED(ARG(threads));
+    UNUSED(ARG(count));
+    fail ("This executable wasn't compiled with NODE_MAGAZINES");
+  #else
+    REBINT max_threads = VAL_INT32(ARG(threads));
+    REBINT count = VAL_INT32(ARG(count));
+    if (max_threads < 1)
+        fail (PAR(threads));
+    if (count < 1)
+        fail (PAR(count));
+
+    // The threads allocate from the pools while this thread waits for them,
+    // so there must be no lazy sweep left to do (only the interpreter thread
+    // may sweep, or signal that it's needed).  A full Recycle() leaves none.
+    // Nothing writes GC_Sweep_Pending until the threads are joined, so their
+    // reads of it in Try_Refill_Magazine() and Free_Node() see this false.
+    //
+    Recycle();
+    assert(not GC_Sweep_Pending);
+
+    struct Reb_Alloc_Bench *benches = TRY_ALLOC_N(
+        struct Reb_Alloc_Bench, max_threads
+    );
+    if (not benches)
+        fail (Error_No_Memory(sizeof(struct Reb_Alloc_Bench) * max_threads));
+
+    REBDSP dsp_orig = DSP;
+    const char *error = nullptr;
+
+    REBINT num_threads;
+    for (num_threads = 1; num_threads <= max_threads; num_threads *= 2) {
+        struct timespec start;
+        clock_gettime(CLOCK_MONOTONIC, &start);
+
+        REBINT started;
+        for (started = 0; started < num_threads; ++started) {
+            benches[started].count = count;
+            benches[started].ok = false;
+            if (0 != pthread_create(
+                &benches[started].thread,
+                nullptr,
+                &Alloc_Bench_Thread,
+                &benches[started]
+            )){
+                break;
+            }
+        }
+
+        bool ok = (started == num_threads);
+        REBINT n;
+        for (n = 0; n < started; ++n) {
+            pthread_join(benches[n].thread, nullptr);
+            ok = ok and benches[n].ok;
+        }
+
+        struct timespec end;
+        clock_gettime(CLOCK_MONOTONIC, &end);
+
+        if (not ok) {
+            error = (started == num_threads)
+                ? "NODE-ALLOC-BENCHMARK ran out of memory"
+                : "NODE-ALLOC-BENCHMARK couldn't start enough threads";
+            break;
+        }
+
+        REBI64 nsecs = (end.tv_sec - start.tv_sec) * cast(REBI64, 1000000000)
+            + (end.tv_nsec - start.tv_nsec);
+        if (nsecs <= 0)
+            nsecs = 1;
+
+        REBDEC allocs = cast(REBDEC, count) * num_threads;
+
+        SET_CELL_FLAG(Init_Integer(DS_PUSH(), num_threads), NEWLINE_BEFORE);
+        Init_Integer(DS_PUSH(), cast(REBI64, allocs * 1000000000.0 / nsecs));
+    }
+
+    FREE_N(struct Reb_Alloc_Bench, max_threads, benches);
+
+    if (error) {
+        DS_DROP_TO(dsp_orig);
+        fail (error);
+    }
+
+    return Init_Block(D_OUT, Pop_Stack_Values(dsp_orig));
+  #endif
+}
+
 //
 //  diagnose: native [
 //
@@ -95,7 +95,7 @@ bool Lookahead_To_Sync_Enfix_Defer_Flag(struct Reb_Feed *feed) {
     if (not IS_WORD(feed->value))
         return false;
 
-    feed->gotten = Lookup_Word(feed->value, FEED_SPECIFIER(feed));
+    feed->gotten = Lookup_Feed_Word(feed);
 
     if (not feed->gotten or not IS_ACTION(unwrap(feed->gotten)))
         return false;
@@ -490,13 +490,31 @@ bool Process_Action_Maybe_Stale_Throws(REBFRM * const f)
             goto continue_fulfilling;
         }
 
+      #ifdef EVAL_COMPUTED_GOTO
+        static void *pclass_labels[REB_P_LOCAL + 1];  // see DISPATCH_CASE()
+        if (not pclass_labels[REB_P_NORMAL]) {
+            REBLEN i;
+            for (i = 0; i <= REB_P_LOCAL; ++i)
+                pclass_labels[i] = &&pclass_default;
+
+            DISPATCH_ENTRY(pclass_labels, pclass, REB_P_NORMAL);
+            DISPATCH_ENTRY(pclass_labels, pclass, REB_P_OUTPUT);
+            DISPATCH_ENTRY(pclass_labels, pclass, REB_P_LITERAL);
+            DISPATCH_ENTRY(pclass_labels, pclass, REB_P_HARD);
+            DISPATCH_ENTRY(pclass_labels, pclass, REB_P_SOFT);
+            DISPATCH_ENTRY(pclass_labels, pclass, REB_P_MEDIUM);
+            DISPATCH_ENTRY(pclass_labels, pclass, REB_P_RETURN);
+        }
+        goto *pclass_labels[pclass];
+      #endif
+
         switch (pclass) {
 
   //=//// REGULAR ARG-OR-REFINEMENT-ARG (consumes 1 EVALUATE's worth) /////=//
 
-          case REB_P_NORMAL:
-          case REB_P_OUTPUT:
-          case REB_P_LITERAL: {
+          DISPATCH_CASE(pclass, REB_P_NORMAL):
+          DISPATCH_CASE(pclass, REB_P_OUTPUT):
+          DISPATCH_CASE(pclass, REB_P_LITERAL): {
             if (GET_FEED_FLAG(f->feed, BARRIER_HIT)) {
                 if (pclass == REB_P_LITERAL)
                     Init_Void(f->arg);
@@ -527,7 +545,7 @@ bool Process_Action_Maybe_Stale_Throws(REBFRM * const f)
 
   //=//// HARD QUOTED ARG-OR-REFINEMENT-ARG ///////////////////////////////=//
 
-          case REB_P_HARD:
+          DISPATCH_CASE(pclass, REB_P_HARD):
             if (not Is_Param_Skippable(f->param))
                 Literal_Next_In_Frame(f->arg, f);  // CELL_FLAG_UNEVALUATED
             else {
@@ -576,8 +594,8 @@ bool Process_Action_Maybe_Stale_Throws(REBFRM * const f)
     // notice a quoting enfix construct afterward looking left, we call
     // into a nested evaluator before finishing the operation.
 
-          case REB_P_SOFT:
-          case REB_P_MEDIUM:
+          DISPATCH_CASE(pclass, REB_P_SOFT):
+          DISPATCH_CASE(pclass, REB_P_MEDIUM):
             Literal_Next_In_Frame(f->arg, f);  // CELL_FLAG_UNEVALUATED
 
             // See remarks on Lookahead_To_Sync_Enfix_Defer_Flag().  We
@@ -638,12 +656,12 @@ bool Process_Action_Maybe_Stale_Throws(REBFRM * const f)
             }
             break;
 
-          case REB_P_RETURN:  // should not happen!
+          DISPATCH_CASE(pclass, REB_P_RETURN):  // should not happen!
             assert(TYPE_CHECK(f->param, REB_TS_REFINEMENT));
             assert(false);
             break;
 
-          default:
+          DISPATCH_DEFAULT(pclass):
             assert(false);
         }
 
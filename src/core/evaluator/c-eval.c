@@ -404,7 +404,7 @@ bool Eval_Maybe_Stale_Throws(REBFRM * const f)
         goto give_up_backward_quote_priority;
 
     assert(not f_next_gotten);  // Fetch_Next_In_Frame() cleared it
-    f_next_gotten = Lookup_Word(f_next, FEED_SPECIFIER(f->feed));
+    f_next_gotten = Lookup_Feed_Word(f->feed);
 
     if (not f_next_gotten or not IS_ACTION(unwrap(f_next_gotten)))
         goto give_up_backward_quote_priority;  // note only ACTION! is ENFIXED
@@ -541,10 +541,81 @@ bool Eval_Maybe_Stale_Throws(REBFRM * const f)
     // Subverting the jump table optimization with specialized branches for
     // fast tests like ANY_INERT() and IS_NULLED_OR_VOID_OR_END() has shown
     // to reduce performance in practice.  The compiler does the right thing.
+    //
+    // (EVAL_COMPUTED_GOTO builds skip the switch's range check and jump via
+    // a table of label addresses instead, see DISPATCH_CASE().)
+
+  #ifdef EVAL_COMPUTED_GOTO
+    static void *kind_labels[256];  // see DISPATCH_CASE(), 0 means not filled
+    if (not kind_labels[REB_0_END]) {
+        REBLEN i;
+        for (i = 0; i < 256; ++i)
+            kind_labels[i] = &&kind_default;
+
+        DISPATCH_ENTRY(kind_labels, kind, REB_0_END);
+        DISPATCH_ENTRY(kind_labels, kind, REB_NULL);
+        DISPATCH_ENTRY(kind_labels, kind, REB_COMMA);
+        DISPATCH_ENTRY(kind_labels, kind, REB_ACTION);
+        DISPATCH_ENTRY(kind_labels, kind, REB_WORD);
+        DISPATCH_ENTRY(kind_labels, kind, REB_SET_WORD);
+        DISPATCH_ENTRY(kind_labels, kind, REB_META_WORD);
+        DISPATCH_ENTRY(kind_labels, kind, REB_GET_WORD);
+        DISPATCH_ENTRY(kind_labels, kind, REB_META_GROUP);
+        DISPATCH_ENTRY(kind_labels, kind, REB_GROUP);
+        DISPATCH_ENTRY(kind_labels, kind, REB_PATH);
+        DISPATCH_ENTRY(kind_labels, kind, REB_TUPLE);
+        DISPATCH_ENTRY(kind_labels, kind, REB_SET_PATH);
+        DISPATCH_ENTRY(kind_labels, kind, REB_SET_TUPLE);
+        DISPATCH_ENTRY(kind_labels, kind, REB_META_PATH);
+        DISPATCH_ENTRY(kind_labels, kind, REB_META_TUPLE);
+        DISPATCH_ENTRY(kind_labels, kind, REB_GET_PATH);
+        DISPATCH_ENTRY(kind_labels, kind, REB_GET_TUPLE);
+        DISPATCH_ENTRY(kind_labels, kind, REB_GET_GROUP);
+        DISPATCH_ENTRY(kind_labels, kind, REB_SET_GROUP);
+        DISPATCH_ENTRY(kind_labels, kind, REB_GET_BLOCK);
+        DISPATCH_ENTRY(kind_labels, kind, REB_SET_BLOCK);
+        DISPATCH_ENTRY(kind_labels, kind, REB_META_BLOCK);
+        DISPATCH_ENTRY(kind_labels, kind, REB_META);
+        DISPATCH_ENTRY(kind_labels, kind, REB_THE);
+        DISPATCH_ENTRY(kind_labels, kind, REB_BLOCK);
+        DISPATCH_ENTRY(kind_labels, kind, REB_BINARY);
+        DISPATCH_ENTRY(kind_labels, kind, REB_TEXT);
+        DISPATCH_ENTRY(kind_labels, kind, REB_FILE);
+        DISPATCH_ENTRY(kind_labels, kind, REB_EMAIL);
+        DISPATCH_ENTRY(kind_labels, kind, REB_URL);
+        DISPATCH_ENTRY(kind_labels, kind, REB_TAG);
+        DISPATCH_ENTRY(kind_labels, kind, REB_ISSUE);
+        DISPATCH_ENTRY(kind_labels, kind, REB_BITSET);
+        DISPATCH_ENTRY(kind_labels, kind, REB_MAP);
+        DISPATCH_ENTRY(kind_labels, kind, REB_VARARGS);
+        DISPATCH_ENTRY(kind_labels, kind, REB_OBJECT);
+        DISPATCH_ENTRY(kind_labels, kind, REB_FRAME);
+        DISPATCH_ENTRY(kind_labels, kind, REB_MODULE);
+        DISPATCH_ENTRY(kind_labels, kind, REB_ERROR);
+        DISPATCH_ENTRY(kind_labels, kind, REB_PORT);
+        DISPATCH_ENTRY(kind_labels, kind, REB_BAD_WORD);
+        DISPATCH_ENTRY(kind_labels, kind, REB_BLANK);
+        DISPATCH_ENTRY(kind_labels, kind, REB_LOGIC);
+        DISPATCH_ENTRY(kind_labels, kind, REB_INTEGER);
+        DISPATCH_ENTRY(kind_labels, kind, REB_DECIMAL);
+        DISPATCH_ENTRY(kind_labels, kind, REB_PERCENT);
+        DISPATCH_ENTRY(kind_labels, kind, REB_MONEY);
+        DISPATCH_ENTRY(kind_labels, kind, REB_PAIR);
+        DISPATCH_ENTRY(kind_labels, kind, REB_TIME);
+        DISPATCH_ENTRY(kind_labels, kind, REB_DATE);
+        DISPATCH_ENTRY(kind_labels, kind, REB_DATATYPE);
+        DISPATCH_ENTRY(kind_labels, kind, REB_TYPESET);
+        DISPATCH_ENTRY(kind_labels, kind, REB_EVENT);
+        DISPATCH_ENTRY(kind_labels, kind, REB_HANDLE);
+        DISPATCH_ENTRY(kind_labels, kind, REB_CUSTOM);
+        DISPATCH_ENTRY(kind_labels, kind, REB_QUOTED);
+    }
+    goto *kind_labels[KIND3Q_BYTE(v)];  // checked version (once)
+  #endif
 
     switch (KIND3Q_BYTE(v)) {  // checked version (once, else kind_current)
 
-      case REB_0_END:
+      DISPATCH_CASE(kind, REB_0_END):
         goto finished;
 
 
@@ -563,7 +634,7 @@ bool Eval_Maybe_Stale_Throws(REBFRM * const f)
     // making it impossible to "reify" the instruction stream as a BLOCK!
     // for the debugger.  Mechanically speaking, this is best left an error.
 
-      case REB_NULL:
+      DISPATCH_CASE(kind, REB_NULL):
         fail (Error_Evaluate_Null_Raw());
 
 
@@ -571,7 +642,7 @@ bool Eval_Maybe_Stale_Throws(REBFRM * const f)
     //
     // A comma is a lightweight looking expression barrier.
 
-       case REB_COMMA:
+      DISPATCH_CASE(kind, REB_COMMA):
         if (GET_EVAL_FLAG(f, FULFILLING_ARG)) {
             CLEAR_FEED_FLAG(f->feed, NO_LOOKAHEAD);
             SET_FEED_FLAG(f->feed, BARRIER_HIT);
@@ -588,7 +659,7 @@ bool Eval_Maybe_Stale_Throws(REBFRM * const f)
     //
     // Most action evaluations are triggered from a WORD! or PATH! case.
 
-      case REB_ACTION: {
+      DISPATCH_CASE(kind, REB_ACTION): {
         DECLARE_ACTION_SUBFRAME (subframe, f);
         Push_Frame(f->out, subframe);
         Push_Action(subframe, VAL_ACTION(v), VAL_ACTION_BINDING(v));
@@ -668,7 +739,7 @@ bool Eval_Maybe_Stale_Throws(REBFRM * const f)
     // or in "stale" left hand situations like `10 comment "hi" + 20`.
 
       process_word:
-      case REB_WORD:
+      DISPATCH_CASE(kind, REB_WORD):
         if (not gotten)
             gotten = Lookup_Word_May_Fail(v, v_specifier);
 
@@ -718,7 +789,7 @@ bool Eval_Maybe_Stale_Throws(REBFRM * const f)
     // Null and void assigns are allowed: https://forum.rebol.info/t/895/4
 
       process_set_word:
-      case REB_SET_WORD: {
+      DISPATCH_CASE(kind, REB_SET_WORD): {
         if (Rightward_Evaluate_Nonvoid_Into_Out_Throws(f, v))  // see notes
             goto return_thrown;
 
@@ -740,11 +811,11 @@ bool Eval_Maybe_Stale_Throws(REBFRM * const f)
     //
     // https://forum.rebol.info/t/1301
 
-      case REB_META_WORD:
+      DISPATCH_CASE(kind, REB_META_WORD):
         STATE_BYTE(f) = ST_EVALUATOR_SYM_WORD;
         goto process_get_word;
 
-      case REB_GET_WORD:
+      DISPATCH_CASE(kind, REB_GET_WORD):
         STATE_BYTE(f) = ST_EVALUATOR_GET_WORD;
         goto process_get_word;
 
@@ -816,11 +887,11 @@ bool Eval_Maybe_Stale_Throws(REBFRM * const f)
     // result was produced (an output of END) and then re-trigger a step in
     // the parent frame, e.g. to pick up the 3 above.
 
-      case REB_META_GROUP:
+      DISPATCH_CASE(kind, REB_META_GROUP):
         STATE_BYTE(f) = ST_EVALUATOR_SYM_GROUP;
         goto eval_group;
 
-      case REB_GROUP:
+      DISPATCH_CASE(kind, REB_GROUP):
         STATE_BYTE(f) = ST_EVALUATOR_GROUP;
         goto eval_group;
 
@@ -932,8 +1003,8 @@ bool Eval_Maybe_Stale_Throws(REBFRM * const f)
     // !!! The dispatch of TUPLE! is a work in progress, with concepts about
     // being less willing to execute functions under some notations.
 
-      case REB_PATH:
-      case REB_TUPLE: {
+      DISPATCH_CASE(kind, REB_PATH):
+      DISPATCH_CASE(kind, REB_TUPLE): {
         if (HEART_BYTE(v) == REB_WORD)
             goto process_word;  // special `/` or `.` case with hidden word
 
@@ -1024,8 +1095,8 @@ bool Eval_Maybe_Stale_Throws(REBFRM * const f)
     //
     // BAD-WORD! and NULL assigns are allowed: https://forum.rebol.info/t/895/4
 
-      case REB_SET_PATH:
-      case REB_SET_TUPLE: {
+      DISPATCH_CASE(kind, REB_SET_PATH):
+      DISPATCH_CASE(kind, REB_SET_TUPLE): {
         if (HEART_BYTE(v) == REB_WORD) {
             assert(VAL_WORD_ID(v) == SYM__SLASH_1_);
             goto process_set_word;
@@ -1068,13 +1139,13 @@ bool Eval_Maybe_Stale_Throws(REBFRM * const f)
     // Consistent with GET-WORD!, a GET-PATH! won't allow BAD-WORD! access on
     // the plain (unfriendly) forms.
 
-      case REB_META_PATH:
-      case REB_META_TUPLE:
+      DISPATCH_CASE(kind, REB_META_PATH):
+      DISPATCH_CASE(kind, REB_META_TUPLE):
         STATE_BYTE(f) = ST_EVALUATOR_SYM_PATH_OR_SYM_TUPLE;
         goto eval_path_or_tuple;
 
-      case REB_GET_PATH:
-      case REB_GET_TUPLE:
+      DISPATCH_CASE(kind, REB_GET_PATH):
+      DISPATCH_CASE(kind, REB_GET_TUPLE):
         STATE_BYTE(f) = ST_EVALUATOR_PATH_OR_TUPLE;
         goto eval_path_or_tuple;
 
@@ -1120,7 +1191,7 @@ bool Eval_Maybe_Stale_Throws(REBFRM * const f)
     // surface, but it means dialects can be free to use it to make a
     // distinction.  For instance, it's used to escape soft quoted slots.
 
-      case REB_GET_GROUP:
+      DISPATCH_CASE(kind, REB_GET_GROUP):
         STATE_BYTE(f) = ST_EVALUATOR_GROUP;
         goto eval_group;
 
@@ -1130,7 +1201,7 @@ bool Eval_Maybe_Stale_Throws(REBFRM * const f)
     // Synonym for SET on the produced thing, unless it's an action...in which
     // case an arity-1 function is allowed to be called and passed the right.
 
-      case REB_SET_GROUP: {
+      DISPATCH_CASE(kind, REB_SET_GROUP): {
         //
         // Protocol for all the REB_SET_XXX is to evaluate the right before
         // the left.  Same with SET_GROUP!.  (Consider in particular the case
@@ -1194,7 +1265,7 @@ bool Eval_Maybe_Stale_Throws(REBFRM * const f)
     //
     // !!! Currently just inert, which may end up being its ultimate usage
 
-      case REB_GET_BLOCK:
+      DISPATCH_CASE(kind, REB_GET_BLOCK):
         Derelativize(f->out, v, v_specifier);
         break;
 
@@ -1220,7 +1291,7 @@ bool Eval_Maybe_Stale_Throws(REBFRM * const f)
     // to be the overall result of the expression (defaults to the normal
     // main return value).
 
-      case REB_SET_BLOCK: {
+      DISPATCH_CASE(kind, REB_SET_BLOCK): {
         assert(NOT_FEED_FLAG(f->feed, NEXT_ARG_FROM_OUT));
 
         // As with the other SET-XXX! variations, we don't want to be able to
@@ -1434,7 +1505,7 @@ bool Eval_Maybe_Stale_Throws(REBFRM * const f)
     //    == '[a b c]
     //
 
-      case REB_META_BLOCK:
+      DISPATCH_CASE(kind, REB_META_BLOCK):
         Inertly_Derelativize_Inheriting_Const(f->out, v, f->feed);
         mutable_KIND3Q_BYTE(f->out) = REB_BLOCK + REB_64;  // quoted
         mutable_HEART_BYTE(f->out) = REB_BLOCK;
@@ -1447,7 +1518,7 @@ bool Eval_Maybe_Stale_Throws(REBFRM * const f)
     // status of BAD-WORD! arguments.  (QUOTE does not take a `^literal`
     // argument so it cannot detect this distinction.)
 
-      case REB_META:
+      DISPATCH_CASE(kind, REB_META):
         if (Rightward_Evaluate_Nonvoid_Into_Out_Throws(f, v))  // see notes
             goto return_thrown;
 
@@ -1463,7 +1534,7 @@ bool Eval_Maybe_Stale_Throws(REBFRM * const f)
     //    >> @ x
     //    == x
 
-      case REB_THE:
+      DISPATCH_CASE(kind, REB_THE):
         if (IS_END(f_next))
             fail ("@ hit end of input");
         Inertly_Derelativize_Inheriting_Const(f->out, f_next, f->feed);
@@ -1488,28 +1559,28 @@ bool Eval_Maybe_Stale_Throws(REBFRM * const f)
     //
     //=////////////////////////////////////////////////////////////////////=//
 
-      case REB_BLOCK:
+      DISPATCH_CASE(kind, REB_BLOCK):
         //
-      case REB_BINARY:
+      DISPATCH_CASE(kind, REB_BINARY):
         //
-      case REB_TEXT:
-      case REB_FILE:
-      case REB_EMAIL:
-      case REB_URL:
-      case REB_TAG:
-      case REB_ISSUE:
+      DISPATCH_CASE(kind, REB_TEXT):
+      DISPATCH_CASE(kind, REB_FILE):
+      DISPATCH_CASE(kind, REB_EMAIL):
+      DISPATCH_CASE(kind, REB_URL):
+      DISPATCH_CASE(kind, REB_TAG):
+      DISPATCH_CASE(kind, REB_ISSUE):
         //
-      case REB_BITSET:
+      DISPATCH_CASE(kind, REB_BITSET):
         //
-      case REB_MAP:
+      DISPATCH_CASE(kind, REB_MAP):
         //
-      case REB_VARARGS:
+      DISPATCH_CASE(kind, REB_VARARGS):
         //
-      case REB_OBJECT:
-      case REB_FRAME:
-      case REB_MODULE:
-      case REB_ERROR:
-      case REB_PORT:
+      DISPATCH_CASE(kind, REB_OBJECT):
+      DISPATCH_CASE(kind, REB_FRAME):
+      DISPATCH_CASE(kind, REB_MODULE):
+      DISPATCH_CASE(kind, REB_ERROR):
+      DISPATCH_CASE(kind, REB_PORT):
         goto inert;
 
 
@@ -1536,7 +1607,7 @@ bool Eval_Maybe_Stale_Throws(REBFRM * const f)
     //     >> get/any 'bar
     //     == ~unset~
 
-      case REB_BAD_WORD:
+      DISPATCH_CASE(kind, REB_BAD_WORD):
         //
         // Source coming through the feed should be guaranteed to not be the
         // isotope form of a BAD-WORD!.  Only objects/frames/etc. have them.
@@ -1563,24 +1634,24 @@ bool Eval_Maybe_Stale_Throws(REBFRM * const f)
     //
     //=///////////////////////////////////////////////////////////////////=//
 
-      case REB_BLANK:
+      DISPATCH_CASE(kind, REB_BLANK):
         //
-      case REB_LOGIC:
-      case REB_INTEGER:
-      case REB_DECIMAL:
-      case REB_PERCENT:
-      case REB_MONEY:
-      case REB_PAIR:
-      case REB_TIME:
-      case REB_DATE:
+      DISPATCH_CASE(kind, REB_LOGIC):
+      DISPATCH_CASE(kind, REB_INTEGER):
+      DISPATCH_CASE(kind, REB_DECIMAL):
+      DISPATCH_CASE(kind, REB_PERCENT):
+      DISPATCH_CASE(kind, REB_MONEY):
+      DISPATCH_CASE(kind, REB_PAIR):
+      DISPATCH_CASE(kind, REB_TIME):
+      DISPATCH_CASE(kind, REB_DATE):
         //
-      case REB_DATATYPE:
-      case REB_TYPESET:
+      DISPATCH_CASE(kind, REB_DATATYPE):
+      DISPATCH_CASE(kind, REB_TYPESET):
         //
-      case REB_EVENT:
-      case REB_HANDLE:
+      DISPATCH_CASE(kind, REB_EVENT):
+      DISPATCH_CASE(kind, REB_HANDLE):
 
-      case REB_CUSTOM:  // custom types (IMAGE!, VECTOR!) are all inert
+      DISPATCH_CASE(kind, REB_CUSTOM):  // custom types (IMAGE!, VECTOR!) are all inert
 
       inert:
 
@@ -1597,7 +1668,7 @@ bool Eval_Maybe_Stale_Throws(REBFRM * const f)
     // (Highly escaped literals should be rare, but for completeness you need
     // to be able to escape any value, including any escaped one...!)
 
-      case REB_QUOTED:
+      DISPATCH_CASE(kind, REB_QUOTED):
         Derelativize(f->out, v, v_specifier);
         Unquotify(f->out, 1);  // take off one level of quoting
         if (IS_BAD_WORD(f->out))
@@ -1611,7 +1682,7 @@ bool Eval_Maybe_Stale_Throws(REBFRM * const f)
     // compact form of literals, which overlay inside the cell they escape.
     // The real type comes from the type modulo 64.
 
-      default:
+      DISPATCH_DEFAULT(kind):
         Derelativize(f->out, v, v_specifier);
         Unquotify_In_Situ(f->out, 1);  // checks for illegal REB_XXX bytes
 
@@ -1778,7 +1849,7 @@ bool Eval_Maybe_Stale_Throws(REBFRM * const f)
     // we can see if it looks up to any kind of ACTION! at all.
 
     if (not f_next_gotten)
-        f_next_gotten = Lookup_Word(f_next, FEED_SPECIFIER(f->feed));
+        f_next_gotten = Lookup_Feed_Word(f->feed);
     else
         assert(f_next_gotten == Lookup_Word(f_next, FEED_SPECIFIER(f->feed)));
 
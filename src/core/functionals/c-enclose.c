@@ -115,6 +115,7 @@ REB_R Encloser_Dispatcher(REBFRM *f)
     // the tracking list Init_Any_Context() expects.  Just fiddle the bit.
     //
     SET_SERIES_FLAG(CTX_VARLIST(c), MANAGED);
+    Keep_From_Lazy_Sweep(CTX_VARLIST(c));
 
     // We're passing the built context to the `outer` function as a FRAME!,
     // which that function can DO (or not).  But when the DO runs, we don't
@@ -142,6 +143,7 @@ REB_R Encloser_Dispatcher(REBFRM *f)
     // bit must be tweaked vs. using Force_Series_Managed.
     //
     SET_SERIES_FLAG(f->varlist, MANAGED);
+    Keep_From_Lazy_Sweep(f->varlist);
 
     // Because the built context is intended to be used with DO, it must be
     // "phaseless".  The property of phaselessness allows detection of when
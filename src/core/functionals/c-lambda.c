@@ -68,6 +68,7 @@ REB_R Lambda_Dispatcher(REBFRM *f)
     assert(IS_BLOCK(block));
 
     SET_SERIES_FLAG(f->varlist, MANAGED);  // not manually tracked...
+    Keep_From_Lazy_Sweep(f->varlist);
 
     // We have to use Make_Or_Reuse_Patch() here, because it could be the
     // case that a higher level wrapper used the frame and virtually bound it.
@@ -39,6 +39,14 @@
 
 #include "sys-core.h"
 
+#if defined(SCAN_SSE2)
+    #include <emmintrin.h>
+
+    #if defined(_MSC_VER)
+        #include <intrin.h>  // _BitScanForward()
+    #endif
+#endif
+
 static inline bool Is_Dot_Or_Slash(char c)
   { return c == '/' or c == '.'; }
 
@@ -293,6 +301,240 @@ const REBYTE Lower_Case[256] =
 #endif
 
 
+//=//// SKIPPING RUNS OF BYTES 16 AT A TIME ///////////////////////////////=//
+//
+// Most bytes in a big input are in runs the scanner just steps over: spaces
+// and tabs, the letters and digits of words and numbers, comments, and the
+// plain characters in strings.  With SSE2, the Skip_XXX() functions below
+// test 16 bytes at a time, and get a bitmask of which bytes end the run.
+//
+// The vector tests only cover the common ASCII bytes of each run, and stop
+// at anything else.  Then the byte-at-a-time Lex_Map loop picks up from
+// there, so the answer is the same as without SSE2 (the only loop in builds
+// without it).
+//
+// Only whole aligned blocks that end at or before the '\0' terminator (the
+// scan state's `tail`) are loaded, so no byte outside the buffer is read.
+// Bytes before the first aligned block, and those in the last partial one,
+// are tested one at a time.
+//
+
+#if defined(SCAN_SSE2)
+
+enum Reb_Scan_Run {
+    SCAN_RUN_SPACES,  // space and tab
+    SCAN_RUN_WORD,  // ASCII letters and digits
+    SCAN_RUN_NUMBER,  // ASCII digits
+    SCAN_RUN_COMMENT,  // anything but CR, LF, or '\0'
+    SCAN_RUN_PLAIN_TEXT  // in strings, ASCII besides ^ { } " and controls
+};
+
+// Bytes in [lo hi] as 0xFF, others as 0.  The compares are signed, so bytes
+// of 0x80 and up (negative) never match ranges of ASCII bytes.
+//
+inline static __m128i In_Range_SSE2(__m128i v, char lo, char hi) {
+    return _mm_and_si128(
+        _mm_cmpgt_epi8(v, _mm_set1_epi8(lo - 1)),
+        _mm_cmplt_epi8(v, _mm_set1_epi8(hi + 1))
+    );
+}
+
+inline static __m128i Is_Byte_SSE2(__m128i v, char c)
+  { return _mm_cmpeq_epi8(v, _mm_set1_epi8(c)); }
+
+// Bitmask of the 16 bytes in `v` which end the run.  The run is a constant
+// at each callsite, so the switch() goes away once this is inlined.
+//
+inline static unsigned int Run_Stops_SSE2(__m128i v, enum Reb_Scan_Run run)
+{
+    __m128i in;
+    switch (run) {
+      case SCAN_RUN_SPACES:
+        in = _mm_or_si128(Is_Byte_SSE2(v, ' '), Is_Byte_SSE2(v, '\t'));
+        break;
+
+      case SCAN_RUN_WORD:  // case-folding with 0x20 maps no others to a-z
+        in = _mm_or_si128(
+            In_Range_SSE2(v, '0', '9'),
+            In_Range_SSE2(_mm_or_si128(v, _mm_set1_epi8(0x20)), 'a', 'z')
+        );
+        break;
+
+      case SCAN_RUN_NUMBER:
+        in = In_Range_SSE2(v, '0', '9');
+        break;
+
+      case SCAN_RUN_COMMENT:
+        in = _mm_or_si128(
+            _mm_or_si128(Is_Byte_SSE2(v, '\0'), Is_Byte_SSE2(v, CR)),
+            Is_Byte_SSE2(v, LF)
+        );
+        return _mm_movemask_epi8(in);  // these bytes are the stops
+
+      case SCAN_RUN_PLAIN_TEXT:
+        in = _mm_andnot_si128(
+            _mm_or_si128(
+                _mm_or_si128(Is_Byte_SSE2(v, '^'), Is_Byte_SSE2(v, '"')),
+                _mm_or_si128(Is_Byte_SSE2(v, '{'), Is_Byte_SSE2(v, '}'))
+            ),
+            _mm_or_si128(In_Range_SSE2(v, ' ', '~'), Is_Byte_SSE2(v, '\t'))
+        );
+        break;
+
+      default:
+        assert(false);
+        in = _mm_setzero_si128();
+    }
+    return ~_mm_movemask_epi8(in) & 0xFFFF;
+}
+
+// Byte-at-a-time version of Run_Stops_SSE2(), for bytes outside the blocks.
+//
+inline static bool In_Run(REBYTE b, enum Reb_Scan_Run run)
+{
+    switch (run) {
+      case SCAN_RUN_SPACES:
+        return b == ' ' or b == '\t';
+
+      case SCAN_RUN_WORD:
+        return (b >= '0' and b <= '9')
+            or ((b | 0x20) >= 'a' and (b | 0x20) <= 'z');
+
+      case SCAN_RUN_NUMBER:
+        return b >= '0' and b <= '9';
+
+      case SCAN_RUN_COMMENT:
+        return b != '\0' and b != CR and b != LF;
+
+      case SCAN_RUN_PLAIN_TEXT:
+        return ((b >= ' ' and b <= '~') or b == '\t')
+            and b != '^' and b != '"' and b != '{' and b != '}';
+
+      default:
+        assert(false);
+        return false;
+    }
+}
+
+inline static unsigned int Lowest_Bit_Index(unsigned int bits) {
+    assert(bits != 0);
+  #if defined(_MSC_VER)
+    unsigned long index;
+    _BitScanForward(&index, bits);
+    return index;
+  #else
+    return __builtin_ctz(bits);
+  #endif
+}
+
+// The first byte at or after `cp` which ends the run, or the start of the
+// partial block before `tail` if the run goes that far.  The caller's byte
+// loop finishes from there.
+//
+inline static const REBYTE *Skip_Run_SSE2(
+    const REBYTE *cp,
+    const REBYTE *tail,  // the '\0' terminator, which ends every run
+    enum Reb_Scan_Run run
+){
+    assert(cp <= tail and *tail == '\0');
+
+    for (; cast(uintptr_t, cp) & 15; ++cp) {  // can't pass tail, '\0' stops
+        if (not In_Run(*cp, run))
+            return cp;
+    }
+
+    for (; tail - cp >= 15; cp += 16) {  // whole block, up to and with tail
+        unsigned int stops = Run_Stops_SSE2(
+            _mm_load_si128(cast(const __m128i*, cp)),
+            run
+        );
+        if (stops != 0)
+            return cp + Lowest_Bit_Index(stops);
+    }
+    return cp;
+}
+
+#endif
+
+
+inline static const REBYTE *Skip_Lex_Spaces(
+    const REBYTE *cp,
+    const REBYTE *tail
+){
+  #if defined(SCAN_SSE2)
+    cp = Skip_Run_SSE2(cp, tail, SCAN_RUN_SPACES);
+  #else
+    UNUSED(tail);
+  #endif
+    while (IS_LEX_SPACE(*cp))
+        ++cp;
+    return cp;
+}
+
+inline static const REBYTE *Skip_Lex_Word_Or_Number(
+    const REBYTE *cp,
+    const REBYTE *tail
+){
+  #if defined(SCAN_SSE2)
+    cp = Skip_Run_SSE2(cp, tail, SCAN_RUN_WORD);
+  #else
+    UNUSED(tail);
+  #endif
+    while (IS_LEX_WORD_OR_NUMBER(*cp))
+        ++cp;
+    return cp;
+}
+
+inline static const REBYTE *Skip_Lex_Number(
+    const REBYTE *cp,
+    const REBYTE *tail
+){
+  #if defined(SCAN_SSE2)
+    cp = Skip_Run_SSE2(cp, tail, SCAN_RUN_NUMBER);
+  #else
+    UNUSED(tail);
+  #endif
+    while (IS_LEX_NUMBER(*cp))
+        ++cp;
+    return cp;
+}
+
+inline static const REBYTE *Skip_To_Line_End(
+    const REBYTE *cp,
+    const REBYTE *tail
+){
+  #if defined(SCAN_SSE2)
+    cp = Skip_Run_SSE2(cp, tail, SCAN_RUN_COMMENT);
+  #else
+    UNUSED(tail);
+  #endif
+    while (not ANY_CR_LF_END(*cp))
+        ++cp;
+    return cp;
+}
+
+// Bytes which Scan_Quote_Push_Mold() can copy into the mold buffer as-is,
+// whether the string is in quotes or braces.
+//
+inline static const REBYTE *Skip_Plain_Text(
+    const REBYTE *cp,
+    const REBYTE *tail
+){
+  #if defined(SCAN_SSE2)
+    cp = Skip_Run_SSE2(cp, tail, SCAN_RUN_PLAIN_TEXT);
+  #else
+    UNUSED(tail);
+  #endif
+    while (
+        ((*cp >= ' ' and *cp <= '~') or *cp == '\t')
+        and *cp != '^' and *cp != '"' and *cp != '{' and *cp != '}'
+    ){
+        ++cp;
+    }
+    return cp;
+}
+
+
 //
 //  Scan_UTF8_Char_Escapable: C
 //
@@ -424,6 +666,13 @@ static const REBYTE *Scan_Quote_Push_Mold(
     REBINT nest = 0;
     REBLEN lines = 0;
     while (*src != term or nest > 0) {
+        const REBYTE *plain = Skip_Plain_Text(src, ss->tail);
+        if (plain != src) {  // no escapes, nesting, or newlines to count
+            Append_Ascii_Len(mo->series, cs_cast(src), plain - src);
+            src = plain;
+            continue;
+        }
+
         REBUNI c = *src;
 
         switch (c) {
@@ -825,8 +1074,7 @@ static LEXFLAGS Prescan_Token(SCAN_STATE *ss)
     const REBYTE *cp = ss->begin;
     LEXFLAGS flags = 0;  // flags for all LEX_SPECIALs seen after ss->begin[0]
 
-    while (IS_LEX_SPACE(*cp))  // skip whitespace (if any)
-        ++cp;
+    cp = Skip_Lex_Spaces(cp, ss->tail);  // skip whitespace (if any)
     ss->begin = cp;  // don't count leading whitespace as part of token
 
     while (true) {
@@ -864,13 +1112,11 @@ static LEXFLAGS Prescan_Token(SCAN_STATE *ss)
             // found, then a flag will be set indicating that also.
             //
             SET_LEX_FLAG(flags, LEX_SPECIAL_WORD);
-            while (IS_LEX_WORD_OR_NUMBER(*cp))
-                ++cp;
+            cp = Skip_Lex_Word_Or_Number(cp, ss->tail);
             break;
 
           case LEX_CLASS_NUMBER:
-            while (IS_LEX_NUMBER(*cp))
-                ++cp;
+            cp = Skip_Lex_Number(cp, ss->tail);
             break;
         }
     }
@@ -1023,6 +1269,7 @@ static enum Reb_Token Locate_Token_May_Push_Mold(
         else {  // It's UTF-8, so have to scan it ordinarily.
 
             ss->begin = cast(const REBYTE*, p);  // breaks the loop...
+            ss->tail = ss->begin + strsize(ss->begin);
 
             // If we're using a va_list, we start the scan with no C string
             // pointer to serve as the beginning of line for an error message.
@@ -1253,8 +1500,7 @@ static enum Reb_Token Locate_Token_May_Push_Mold(
 
       case LEX_CLASS_SPECIAL:
         if (GET_LEX_VALUE(*cp) == LEX_SPECIAL_SEMICOLON) {  // begin comment
-            while (not ANY_CR_LF_END(*cp))
-                ++cp;
+            cp = Skip_To_Line_End(cp, ss->tail);
             if (*cp == '\0')
                 return TOKEN_END;  // `load ";"` is [] with no newline on tail
             if (*cp == LF)
@@ -1698,6 +1944,10 @@ void Init_Va_Scan_Level_Core(
 
     ss->begin = opt_begin;  // if null, Locate_Token's first fetch from vaptr
     TRASH_POINTER_IF_DEBUG(ss->end);
+    if (opt_begin)
+        ss->tail = opt_begin + strsize(opt_begin);
+    else
+        TRASH_POINTER_IF_DEBUG(ss->tail);
 
     ss->file = file;
     ss->depth = 0;
@@ -1730,14 +1980,17 @@ void Init_Scan_Level(
 ){
     out->ss = ss;
 
-    if (limit != UNLIMITED)
-        assert(utf8[limit] == '\0');  // !!! for now, only limit allowed
-    UNUSED(limit);
-
     ss->feed = nullptr;  // signal Locate_Token this isn't a variadic scan
     ss->begin = utf8;
     TRASH_POINTER_IF_DEBUG(ss->end);
 
+    if (limit != UNLIMITED) {
+        assert(utf8[limit] == '\0');  // !!! for now, only limit allowed
+        ss->tail = utf8 + limit;
+    }
+    else
+        ss->tail = utf8 + strsize(utf8);
+
     ss->file = file;
     ss->feed = nullptr;
     ss->depth = 0;
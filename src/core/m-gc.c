@@ -50,20 +50,33 @@
 // spot).  This queue is then handled as soon as the marking call is exited,
 // and the process repeated until no more items are queued.
 //
-// !!! There is actually not a specific list of roots of the garbage collect,
-// so a first pass of all the REBSER nodes must be done to find them.  This is
-// because with the redesigned "RL_API" in Ren-C, ordinary REBSER nodes do
-// double duty as lifetime-managed containers for REBVALs handed out by the
-// API--without requiring a separate series data allocation.  These could be
-// in their own "pool", but that would prevent mingling and reuse among REBSER
-// nodes used for other purposes.  Review in light of any new garbage collect
-// approaches used.
+// With the redesigned "RL_API" in Ren-C, ordinary REBSER nodes do double
+// duty as lifetime-managed containers for REBVALs handed out by the API
+// (without requiring a separate series data allocation).  These are roots of
+// the garbage collect, and are found through the lists that track them (the
+// frame each handle belongs to, GC_Manuals, GC_Roots)...not by making a first
+// pass over all the REBSER nodes.  See Mark_Root_Series().
+//
+// RECYCLE/LAZY makes automatic recycles stop after marking.  The SER_POOL is
+// then swept a segment at a time between evaluator steps, when allocations
+// find the free list empty (see Sweep_Lazily()).  Until a segment is swept,
+// an unmarked managed node in it is taken to be garbage.  So nodes that
+// become managed (or get found through a weak reference like the symbol
+// table) while the sweep is pending have to be given a mark, see
+// Keep_From_Lazy_Sweep().  DEBUG_CHECK_LAZY_SWEEP checks that they are.
+//
+// How much gets allocated between automatic recycles starts out as the fixed
+// "ballast" (MEM_BALLAST, or RECYCLE/BALLAST).  The pacing settings let that
+// follow the size of the heap, space out recycles whose pause is too long,
+// and put a floor under the time between them.  See Pace_Next_Recycle().
 //
 
 #include "sys-core.h"
 
 #include "sys-int-funcs.h"
 
+#include <time.h>  // clock(), for timing recycles
+
 
 // The reason the LINK() and MISC() macros are so weird is because regardless
 // of who assigns the fields, the GC wants to be able to mark them.  So the
@@ -100,6 +113,7 @@
 //
 
 static void Mark_Devices_Deep(void);
+static void Mark_Live_Nodes(bool shutdown);
 
 
 #ifndef NDEBUG
@@ -173,6 +187,8 @@ static void Queue_Mark_Node_Deep(void *p)
     if (first & NODE_BYTEMASK_0x10_MARKED)
         return;  // may not be finished marking yet, but has been queued
 
+    ++GC_Stats.Last_Marked;
+
     if (first & NODE_BYTEMASK_0x01_CELL) {  // e.g. a pairing
         REBVAL *v = VAL(p);
         if (GET_CELL_FLAG(v, MANAGED))
@@ -496,117 +512,123 @@ void Reify_Va_To_Array_In_Frame(
 }
 
 
+// Alloc_Value() nodes are "roots": all references to them should be from
+// the C stack, so only this visit should be marking them.
+//
+static void Mark_Api_Root(REBARR *a)
+{
+    assert(not (a->leader.bits & NODE_FLAG_MARKED));
+
+    if (not (a->leader.bits & NODE_FLAG_MANAGED)) {
+        // if it's not managed, don't mark it (don't have to?)
+    }
+    else  // Note that Mark_Frame_Stack_Deep() will mark the owner
+        a->leader.bits |= NODE_FLAG_MARKED;
+
+    // Note: Eval_Core() might target API cells, uses END
+    //
+    Queue_Mark_Opt_End_Cell_Deep(ARR_SINGLE(a));
+}
+
+
+// An unmanaged array isn't marked itself (it's not subject to GC), but what
+// it holds has to be kept alive.
+//
+static void Mark_Unmanaged_Array(REBARR *a)
+{
+    // Only plain arrays are supported as unmanaged across evaluations,
+    // because REBCTX and REBACT and REBMAP are too complex...they must be
+    // managed before evaluations happen.  Manage and use PUSH_GC_GUARD and
+    // DROP_GC_GUARD on them.
+    //
+    assert(
+        not IS_VARLIST(a)
+        and not IS_DETAILS(a)
+        and not IS_PAIRLIST(a)
+    );
+
+    if (GET_SERIES_FLAG(a, LINK_NODE_NEEDS_MARK))
+        if (node_LINK(Node, a))
+            Queue_Mark_Node_Deep(node_LINK(Node, a));
+    if (GET_SERIES_FLAG(a, MISC_NODE_NEEDS_MARK))
+        if (node_MISC(Node, a))
+            Queue_Mark_Node_Deep(node_MISC(Node, a));
+
+    const RELVAL *item_tail = ARR_TAIL(a);
+    RELVAL *item = ARR_HEAD(a);
+    for (; item != item_tail; ++item)
+        Queue_Mark_Value_Deep(item);
+}
+
+
 //
 //  Mark_Root_Series: C
 //
 // Root Series are any manual series that were allocated but have not been
 // managed yet, as well as Alloc_Value() nodes that are explicitly "roots".
 //
-// For root nodes, this checks to see if their lifetime was dependent on a
-// FRAME!, and if that frame is no longer on the stack.  If so, it (currently)
-// will panic if that frame did not end due to a fail().  This could be
-// relaxed to automatically free those nodes as a normal GC.
+// These used to be found by walking over *all* the nodes in the series pool,
+// which made every recycle pay for every allocated node.  Instead, the roots
+// are taken from the lists which already track them:
+//
+// * API handles with frame lifetimes are in the alloc_value_list of the
+//   frame that owns them (and frames don't outlive the stack)
 //
-// !!! This implementation walks over *all* the nodes.  It wouldn't have to
-// if API nodes were in their own pool, or if the outstanding manuals list
-// were maintained even in non-debug builds--it could just walk those.  This
-// should be weighed against background GC and other more sophisticated
-// methods which might come down the road for the GC than this simple one.
+// * Arrays from Make_Array() that haven't been managed are in GC_Manuals
+//
+// * Unmanaged API handles (rebUnmanage()) and API instructions (rebQ(), etc.)
+//   are kept in GC_Roots, see Track_Root_Array()
 //
 static void Mark_Root_Series(void)
 {
-    REBSEG *seg;
-    for (seg = Mem_Pools[SER_POOL].segs; seg; seg = seg->next) {
-        REBYTE *unit = cast(REBYTE*, seg + 1);
-        REBLEN n = Mem_Pools[SER_POOL].num_units;
-        for (; n > 0; --n, unit += sizeof(REBSER)) {
-            //
-            // !!! A smarter switch statement here could do this more
-            // optimally...see the sweep code for an example.
-            //
-            REBYTE nodebyte = *unit;
-            if (nodebyte & NODE_BYTEMASK_0x40_FREE)
-                continue;
-
-            assert(nodebyte & NODE_BYTEMASK_0x80_NODE);
-
-            if (nodebyte & NODE_BYTEMASK_0x02_ROOT) {
-                //
-                // This came from Alloc_Value(); all references should be
-                // from the C stack, only this visit should be marking it.
-                //
-                REBARR *a = ARR(cast(void*, unit));
-
-                assert(not (a->leader.bits & NODE_FLAG_MARKED));
-
-                if (not (a->leader.bits & NODE_FLAG_MANAGED)) {
-                    // if it's not managed, don't mark it (don't have to?)
-                }
-                else  // Note that Mark_Frame_Stack_Deep() will mark the owner
-                    a->leader.bits |= NODE_FLAG_MARKED;
-
-                // Note: Eval_Core() might target API cells, uses END
-                //
-                Queue_Mark_Opt_End_Cell_Deep(ARR_SINGLE(a));
-                continue;
-            }
-
-            if (nodebyte & NODE_BYTEMASK_0x01_CELL) {  // a pairing
-                REBVAL *paired = VAL(cast(void*, unit));
-                if (paired->header.bits & NODE_FLAG_MANAGED)
-                    continue; // PAIR! or other value will mark it
-
-                assert(!"unmanaged pairings not believed to exist yet");
-                Queue_Mark_Opt_Value_Deep(paired);
-                Queue_Mark_Opt_Value_Deep(PAIRING_KEY(paired));
-            }
-
-            REBSER *s = SER(cast(void*, unit));
-            if (IS_SER_ARRAY(s)) {
-                if (s->leader.bits & NODE_FLAG_MANAGED)
-                    continue; // BLOCK! should mark it
+    REBFRM *f = FS_TOP;
+    while (f) {  // null at shutdown, after the frame stack is gone
+        REBNOD *n = f->alloc_value_list;
+        while (n != f) {
+            REBARR *a = ARR(n);
+            assert(GET_SERIES_FLAG(a, ROOT));
+            Mark_Api_Root(a);
+            n = LINK(ApiNext, a);
+        }
+        Propagate_All_GC_Marks();
 
-                REBARR *a = ARR(s);
+        if (f == FS_BOTTOM)
+            break;
+        f = f->prior;
+    }
 
-                if (IS_VARLIST(a))
-                    if (CTX_TYPE(CTX(a)) == REB_FRAME)
-                        continue;  // Mark_Frame_Stack_Deep() etc. mark it
+    REBARR **root_tail = SER_TAIL(REBARR*, GC_Roots);
+    REBARR **root = SER_HEAD(REBARR*, GC_Roots);
+    for (; root != root_tail; ++root) {
+        if (GET_SERIES_FLAG(*root, ROOT))
+            Mark_Api_Root(*root);
+        else
+            Mark_Unmanaged_Array(*root);  // e.g. rebQ() instruction
+    }
+    Propagate_All_GC_Marks();
 
-                // This means someone did something like Make_Array() and then
-                // ran an evaluation before referencing it somewhere from the
-                // root set.
+    REBSER **manual_tail = SER_TAIL(REBSER*, GC_Manuals);
+    REBSER **manual = SER_HEAD(REBSER*, GC_Manuals);
+    for (; manual != manual_tail; ++manual) {
+        REBSER *s = *manual;
 
-                // Only plain arrays are supported as unmanaged across
-                // evaluations, because REBCTX and REBACT and REBMAP are too
-                // complex...they must be managed before evaluations happen.
-                // Manage and use PUSH_GC_GUARD and DROP_GC_GUARD on them.
-                //
-                assert(
-                    not IS_VARLIST(a)
-                    and not IS_DETAILS(a)
-                    and not IS_PAIRLIST(a)
-                );
-
-                if (GET_SERIES_FLAG(a, LINK_NODE_NEEDS_MARK))
-                    if (node_LINK(Node, a))
-                        Queue_Mark_Node_Deep(node_LINK(Node, a));
-                if (GET_SERIES_FLAG(a, MISC_NODE_NEEDS_MARK))
-                    if (node_MISC(Node, a))
-                        Queue_Mark_Node_Deep(node_MISC(Node, a));
-
-                const RELVAL *item_tail = ARR_TAIL(a);
-                RELVAL *item = ARR_HEAD(a);
-                for (; item != item_tail; ++item)
-                    Queue_Mark_Value_Deep(item);
-            }
+        // At present, no handling for unmanaged STRING!, BINARY!, etc.
+        // This would have to change, e.g. if any of other types stored
+        // something on the heap in their LINK() or MISC()
+        //
+        if (not IS_SER_ARRAY(s))
+            continue;
 
-            // At present, no handling for unmanaged STRING!, BINARY!, etc.
-            // This would have to change, e.g. if any of other types stored
-            // something on the heap in their LINK() or MISC()
-        }
+        REBARR *a = ARR(s);
+        if (IS_VARLIST(a) and CTX_TYPE(CTX(a)) == REB_FRAME)
+            continue;  // Mark_Frame_Stack_Deep() etc. mark it
 
-        Propagate_All_GC_Marks(); // !!! is propagating on each segment good?
+        // This means someone did something like Make_Array() and then ran
+        // an evaluation before referencing it somewhere from the root set.
+        //
+        Mark_Unmanaged_Array(a);
     }
+    Propagate_All_GC_Marks();
 }
 
 
@@ -861,122 +883,147 @@ static void Mark_Frame_Stack_Deep(void)
 }
 
 
+// What the sweep decides to do with a unit in the SER_POOL.
 //
-//  Sweep_Series: C
-//
-// Scans all series nodes (REBSER structs) in all segments that are part of
-// the SER_POOL.  If a series had its lifetime management delegated to the
-// garbage collector with Manage_Series(), then if it didn't get "marked" as
-// live during the marking phase then free it.
+enum Reb_Sweep_Verdict {
+    SWEEP_KEEP,  // unmanaged, free, or marked (mark gets cleared)
+    SWEEP_FREE,  // managed and unmarked, so should be GC'd
+    SWEEP_CORRUPT  // bit pattern that should not be possible
+};
+
+
+// This only looks at (and possibly changes the mark bit of) the unit itself.
+// It's shared by the full sweep and the lazy sweep of a single segment.
 //
-static REBLEN Sweep_Series(void)
+inline static enum Reb_Sweep_Verdict Sweep_Verdict(REBYTE *unit)
 {
-    REBLEN count = 0;
+    switch (*unit >> 4) {
+      case 0:
+      case 1:  // 0x1
+      case 2:  // 0x2
+      case 3:  // 0x2 + 0x1
+      case 4:  // 0x4
+      case 5:  // 0x4 + 0x1
+      case 6:  // 0x4 + 0x2
+      case 7:  // 0x4 + 0x2 + 0x1
+        //
+        // NODE_FLAG_NODE (0x8) is clear.  This signature is
+        // reserved for UTF-8 strings (corresponding to valid ASCII
+        // values in the first byte).
+        //
+        return SWEEP_CORRUPT;
 
-    REBSEG *seg = Mem_Pools[SER_POOL].segs;
-    for (; seg != nullptr; seg = seg->next) {
-        REBLEN n = Mem_Pools[SER_POOL].num_units;
+    // v-- Everything below here has NODE_FLAG_NODE set (0x8)
 
-        // We use a generic byte pointer (unsigned char*) to dodge the rules
-        // for strict aliasing, as the pool may contain pairs of REBVAL from
-        // Alloc_Pairing(), or a REBSER from Alloc_Series_Node().  The shared
-        // first byte node masks are defined and explained in %sys-rebnod.h
+      case 8:
+        // 0x8: unmanaged and unmarked, e.g. a series that was made
+        // with Make_Series() and hasn't been managed.  It doesn't
+        // participate in the GC.  Leave it as is.
+        //
+        // !!! Are there actually legitimate reasons to do this with
+        // arrays, where the creator knows the cells do not need
+        // GC protection?  Should finding an array in this state be
+        // considered a problem (e.g. the GC ran when you thought it
+        // couldn't run yet, hence would be able to free the array?)
         //
-        // NOTE: If you are using a build with UNUSUAL_REBVAL_SIZE such as
-        // DEBUG_TRACK_EXTEND_CELLS, then this will be processing the REBSER
-        // nodes only--see loop lower down for the pairing pool enumeration.
+        return SWEEP_KEEP;
 
-        REBYTE *unit = cast(REBYTE*, seg + 1);
+      case 9:
+        // 0x8 + 0x1: marked but not managed, this can't happen,
+        // because the marking itself asserts nodes are managed.
+        //
+        return SWEEP_CORRUPT;
 
-        for (; n > 0; --n, unit += sizeof(REBSER)) {
-            switch (*unit >> 4) {
-              case 0:
-              case 1:  // 0x1
-              case 2:  // 0x2
-              case 3:  // 0x2 + 0x1
-              case 4:  // 0x4
-              case 5:  // 0x4 + 0x1
-              case 6:  // 0x4 + 0x2
-              case 7:  // 0x4 + 0x2 + 0x1
-                //
-                // NODE_FLAG_NODE (0x8) is clear.  This signature is
-                // reserved for UTF-8 strings (corresponding to valid ASCII
-                // values in the first byte).
-                //
-                panic (unit);
+      case 10:
+        // 0x8 + 0x2: managed but didn't get marked, should be GC'd
+        //
+        // API handles are roots, Mark_Root_Series() should have found them
+        // through their owning frame.
+        //
+        assert(not (*unit & NODE_BYTEMASK_0x02_ROOT));
+        return SWEEP_FREE;
 
-            // v-- Everything below here has NODE_FLAG_NODE set (0x8)
+      case 11:
+        // 0x8 + 0x2 + 0x1: managed and marked, so it's still live.
+        // Don't GC it, just clear the mark.
+        //
+        *unit &= ~NODE_BYTEMASK_0x10_MARKED;
+        return SWEEP_KEEP;
 
-              case 8:
-                // 0x8: unmanaged and unmarked, e.g. a series that was made
-                // with Make_Series() and hasn't been managed.  It doesn't
-                // participate in the GC.  Leave it as is.
-                //
-                // !!! Are there actually legitimate reasons to do this with
-                // arrays, where the creator knows the cells do not need
-                // GC protection?  Should finding an array in this state be
-                // considered a problem (e.g. the GC ran when you thought it
-                // couldn't run yet, hence would be able to free the array?)
-                //
-                break;
+    // v-- Everything below this line has the two leftmost bits set
+    // in the header.  In the *general* case this could be a valid
+    // first byte of a multi-byte sequence in UTF-8...so only the
+    // special bit pattern of the free case uses this.
 
-              case 9:
-                // 0x8 + 0x1: marked but not managed, this can't happen,
-                // because the marking itself asserts nodes are managed.
-                //
-                panic (unit);
+      case 12:
+        // 0x8 + 0x4: free node, uses special illegal UTF-8 byte
+        //
+        assert(*unit == FREED_SERIES_BYTE);
+        return SWEEP_KEEP;
 
-              case 10:
-                // 0x8 + 0x2: managed but didn't get marked, should be GC'd
-                //
-                // !!! It would be nice if we could have NODE_FLAG_CELL here
-                // as part of the switch, but see its definition for why it
-                // is at position 8 from left and not an earlier bit.
-                //
-                if (*unit & NODE_BYTEMASK_0x01_CELL) {
-                    assert(not (*unit & NODE_BYTEMASK_0x02_ROOT));
-                    Free_Node(SER_POOL, NOD(unit));  // Free_Pairing manual
-                }
-                else {
-                    REBSER *s = cast(REBSER*, unit);
-                    GC_Kill_Series(s);
-                }
-                ++count;
-                break;
+      default:  // 13, 14, 15
+        return SWEEP_CORRUPT;  // 0x8 + 0x4 + ... reserved for UTF-8
+    }
+}
 
-              case 11:
-                // 0x8 + 0x2 + 0x1: managed and marked, so it's still live.
-                // Don't GC it, just clear the mark.
-                //
-                *unit &= ~NODE_BYTEMASK_0x10_MARKED;
-                break;
 
-            // v-- Everything below this line has the two leftmost bits set
-            // in the header.  In the *general* case this could be a valid
-            // first byte of a multi-byte sequence in UTF-8...so only the
-            // special bit pattern of the free case uses this.
+// !!! It would be nice if we could have NODE_FLAG_CELL in the switch of
+// Sweep_Verdict(), but see its definition for why it is at position 8 from
+// left and not an earlier bit.
+//
+static void Free_Swept_Unit(REBYTE *unit)
+{
+    if (*unit & NODE_BYTEMASK_0x01_CELL)
+        Free_Node(SER_POOL, NOD(unit));  // Free_Pairing is for manuals
+    else
+        GC_Kill_Series(SER(cast(void*, unit)));
+}
 
-              case 12:
-                // 0x8 + 0x4: free node, uses special illegal UTF-8 byte
-                //
-                assert(*unit == FREED_SERIES_BYTE);
-                break;
 
-              case 13:
-              case 14:
-              case 15:
-                panic (unit);  // 0x8 + 0x4 + ... reserved for UTF-8
-            }
+// We use a generic byte pointer (unsigned char*) to dodge the rules for
+// strict aliasing, as the pool may contain pairs of REBVAL from
+// Alloc_Pairing(), or a REBSER from Alloc_Series_Node().  The shared first
+// byte node masks are defined and explained in %sys-rebnod.h
+//
+static REBLEN Sweep_Segment(REBSEG *seg)
+{
+    REBLEN count = 0;
+
+    REBYTE *unit = cast(REBYTE*, seg + 1);
+    REBLEN n = Mem_Pools[SER_POOL].num_units;
+    for (; n > 0; --n, unit += sizeof(REBSER)) {
+        switch (Sweep_Verdict(unit)) {
+          case SWEEP_KEEP:
+            break;
+
+          case SWEEP_FREE:
+            Free_Swept_Unit(unit);
+            ++count;
+            break;
+
+          case SWEEP_CORRUPT:
+            panic (unit);
         }
     }
 
-    // For efficiency of memory use, REBSER is nominally defined as
-    // 2*sizeof(REBVAL), and so pairs can use the same nodes.  But features
-    // that might make the cells a size greater than REBSER size require
-    // doing pairings in a different pool.
-    //
-  #ifdef UNUSUAL_REBVAL_SIZE
-    for (seg = Mem_Pools[PAR_POOL].segs; seg != NULL; seg = seg->next) {
+    return count;
+}
+
+
+#ifdef UNUSUAL_REBVAL_SIZE
+
+//
+//  Sweep_Pairings: C
+//
+// If cells are bigger than usual, the PAR_POOL is separate from SER_POOL, and
+// is swept on its own.
+//
+static REBLEN Sweep_Pairings(void)
+{
+    REBLEN count = 0;
+
+    REBSEG *seg = Mem_Pools[PAR_POOL].segs;
+    for (; seg != nullptr; seg = seg->next) {
         REBVAL *v = cast(REBVAL*, seg + 1);
         REBLEN n = Mem_Pools[PAR_POOL].num_units;
         for (; n > 0; --n, v += 2) {
@@ -998,12 +1045,365 @@ static REBLEN Sweep_Series(void)
             }
         }
     }
+
+    return count;
+}
+
+#endif
+
+
+//
+//  Sweep_Series: C
+//
+// Scans all series nodes (REBSER structs) in all segments that are part of
+// the SER_POOL.  If a series had its lifetime management delegated to the
+// garbage collector with Manage_Series(), then if it didn't get "marked" as
+// live during the marking phase then free it.
+//
+// NOTE: If you are using a build with UNUSUAL_REBVAL_SIZE such as
+// DEBUG_TRACK_EXTEND_CELLS, then the SER_POOL only has REBSER nodes in it,
+// see Sweep_Pairings() for the pairing pool enumeration.
+//
+static REBLEN Sweep_Series(void)
+{
+    REBLEN count = 0;
+
+    REBSEG *seg = Mem_Pools[SER_POOL].segs;
+    for (; seg != nullptr; seg = seg->next)
+        count += Sweep_Segment(seg);
+
+    // For efficiency of memory use, REBSER is nominally defined as
+    // 2*sizeof(REBVAL), and so pairs can use the same nodes.  But features
+    // that might make the cells a size greater than REBSER size require
+    // doing pairings in a different pool.
+    //
+  #ifdef UNUSUAL_REBVAL_SIZE
+    count += Sweep_Pairings();
   #endif
 
     return count;
 }
 
 
+//
+//  Start_Lazy_Sweep: C
+//
+// Instead of sweeping the SER_POOL at the end of the recycle, make a list of
+// its segments and start the free list over as empty.  The segments are then
+// swept as units are needed (see Sweep_Lazily()), so the pause for the
+// recycle is only as long as the marking takes.
+//
+// No unit can be handed out from a segment that hasn't been swept yet, since
+// the sweep would take it for garbage.  Segments added by Try_Fill_Pool() in
+// the meantime are not in the list, and Free_Node() leaves units that are in
+// unswept segments for the sweep to put back on the free list.
+//
+static void Start_Lazy_Sweep(void)
+{
+    REBPOL *pool = &Mem_Pools[SER_POOL];
+
+    assert(SER_USED(GC_Unswept) == 0);
+
+    REBLEN num_segs = 0;
+    REBSEG *seg;
+    for (seg = pool->segs; seg != nullptr; seg = seg->next)
+        ++num_segs;
+
+    EXPAND_SERIES_TAIL(GC_Unswept, num_segs);
+
+    REBSEG **segs = SER_HEAD(REBSEG*, GC_Unswept);
+    for (seg = pool->segs; seg != nullptr; seg = seg->next)
+        *segs++ = seg;
+
+    reb_qsort_r(
+        SER_HEAD(REBSEG*, GC_Unswept),
+        num_segs,
+        sizeof(REBSEG*),
+        nullptr,
+        &Compare_Segments
+    );
+
+  #if defined(NODE_MAGAZINES)
+    TG_Magazines[SER_POOL].count = 0;  // the sweep will relink those units
+  #endif
+
+    pool->first = nullptr;
+    pool->last = nullptr;
+    pool->free = 0;
+
+    GC_Sweep_Pending = (num_segs != 0);
+}
+
+
+// Freeing a unit can free others (e.g. a string's bookmarks), which may be
+// later in the segment being swept.  Those count as unswept, so Free_Node()
+// leaves them for the sweep to find instead of putting them on the free list
+// a second time.
+//
+static REBYTE *sweep_cursor = nullptr;  // units from here to the limit...
+static REBYTE *sweep_limit = nullptr;  // ...haven't been swept yet
+
+
+//
+//  Sweep_Unswept_Segment: C
+//
+// Sweep the last segment in the GC_Unswept list.  Units that were already
+// free (including any freed since the recycle) are put back on the free list,
+// and units the sweep frees go on the free list as usual.
+//
+static REBLEN Sweep_Unswept_Segment(void)
+{
+    REBPOL *pool = &Mem_Pools[SER_POOL];
+
+    REBLEN num_unswept = SER_USED(GC_Unswept);
+    assert(num_unswept != 0);
+    REBSEG *seg = *SER_AT(REBSEG*, GC_Unswept, num_unswept - 1);
+    SET_SERIES_USED(GC_Unswept, num_unswept - 1);
+
+    REBYTE *saved_cursor = sweep_cursor;  // a cleaner could RECYCLE
+    REBYTE *saved_limit = sweep_limit;
+    sweep_limit = cast(REBYTE*, seg) + seg->size;
+
+    REBLEN count = 0;
+
+    REBYTE *unit = cast(REBYTE*, seg + 1);
+    REBLEN n = pool->num_units;
+    for (; n > 0; --n, unit += sizeof(REBSER)) {
+        sweep_cursor = unit + sizeof(REBSER);
+
+        if (*unit == FREED_SERIES_BYTE) {
+            REBPLU *plu = cast(REBPLU*, unit);
+            if (not pool->first)
+                pool->last = plu;
+            plu->next_if_free = pool->first;
+            pool->first = plu;
+            ++pool->free;
+            continue;
+        }
+
+        if ((*unit >> 4) == 9) {  // 0x8 + 0x1: marked, then unmanaged
+            *unit &= ~NODE_BYTEMASK_0x10_MARKED;  // e.g. by rebUnmanage()
+            continue;
+        }
+
+        switch (Sweep_Verdict(unit)) {
+          case SWEEP_KEEP:
+            break;
+
+          case SWEEP_FREE:
+            Free_Swept_Unit(unit);
+            ++count;
+            break;
+
+          case SWEEP_CORRUPT:
+            panic (unit);
+        }
+    }
+
+    sweep_cursor = saved_cursor;
+    sweep_limit = saved_limit;
+
+    // Freeing units can run handle cleaners, which could run a RECYCLE that
+    // sweeps the rest...so this is checked after, not when the list is popped.
+    //
+    if (SER_USED(GC_Unswept) == 0)
+        GC_Sweep_Pending = false;
+
+    return count;
+}
+
+
+#if defined(DEBUG_CHECK_LAZY_SWEEP)
+
+//
+//  Check_Lazy_Sweep_Debug: C
+//
+// A managed node that the lazy sweep hasn't reached yet is freed by the sweep
+// unless it has a mark.  If a node was made managed or found again without a
+// Keep_From_Lazy_Sweep(), it can still be reachable with no mark.  This runs
+// the marking phase again to look for any such node, which is very slow...so
+// it's only done when DEBUG_CHECK_LAZY_SWEEP is defined.
+//
+// The marks left by the recycle (and Keep_From_Lazy_Sweep()) are put back
+// afterward, so this doesn't change what the sweep will do.
+//
+static void Check_Lazy_Sweep_Debug(void)
+{
+    REBPOL *pool = &Mem_Pools[SER_POOL];
+
+    REBLEN num_units = 0;
+    REBSEG *seg;
+    for (seg = pool->segs; seg != nullptr; seg = seg->next)
+        num_units += pool->num_units;
+
+    bool *was_marked = cast(bool*, calloc(num_units, sizeof(bool)));
+    if (was_marked == nullptr)
+        panic ("Not enough memory for Check_Lazy_Sweep_Debug()");
+
+    REBLEN i = 0;
+    for (seg = pool->segs; seg != nullptr; seg = seg->next) {
+        REBYTE *unit = cast(REBYTE*, seg + 1);
+        REBLEN n = pool->num_units;
+        for (; n > 0; --n, ++i, unit += sizeof(REBSER)) {
+            if (*unit == FREED_SERIES_BYTE)
+                continue;
+
+            if (*unit & NODE_BYTEMASK_0x10_MARKED) {
+                was_marked[i] = true;
+                *unit &= ~NODE_BYTEMASK_0x10_MARKED;
+            }
+        }
+    }
+
+    REBI64 last_marked = GC_Stats.Last_Marked;
+    Mark_Live_Nodes(false);
+    ASSERT_NO_GC_MARKS_PENDING();
+    GC_Stats.Last_Marked = last_marked;
+
+    i = 0;
+    for (seg = pool->segs; seg != nullptr; seg = seg->next) {
+        REBYTE *unit = cast(REBYTE*, seg + 1);
+        REBLEN n = pool->num_units;
+        for (; n > 0; --n, ++i, unit += sizeof(REBSER)) {
+            if (*unit == FREED_SERIES_BYTE)
+                continue;
+
+            if (
+                not was_marked[i]
+                and (*unit & NODE_BYTEMASK_0x10_MARKED)
+                and Is_Node_Unswept(unit)
+            ){
+                printf("Lazy sweep would free a node that can be reached\n");
+                fflush(stdout);
+                panic (unit);
+            }
+
+            if (was_marked[i])
+                *unit |= NODE_BYTEMASK_0x10_MARKED;
+            else
+                *unit &= ~NODE_BYTEMASK_0x10_MARKED;
+        }
+    }
+
+  #ifdef UNUSUAL_REBVAL_SIZE
+    for (seg = Mem_Pools[PAR_POOL].segs; seg != nullptr; seg = seg->next) {
+        REBVAL *v = cast(REBVAL*, seg + 1);
+        REBLEN n = Mem_Pools[PAR_POOL].num_units;
+        for (; n > 0; --n, v += 2) {  // swept already, no marks to put back
+            if (not (v->header.bits & NODE_FLAG_FREE))
+                v->header.bits &= ~NODE_FLAG_MARKED;
+        }
+    }
+  #endif
+
+    free(was_marked);
+}
+
+#endif
+
+
+//
+//  Sweep_Lazily: C
+//
+// When the SER_POOL runs out of free units while a lazy sweep is pending,
+// Try_Alloc_Node() fills it with a new segment as usual and sets SIG_SWEEP.
+// Sweeping can free nodes and run handle cleaners, which isn't safe to do in
+// the middle of an allocation...so it waits for Do_Signals_Throws() to call
+// this between evaluator steps.
+//
+// At least one segment is swept, and then more until the pool has some free
+// units again.  This spreads the cost of the sweep over the steps that are
+// allocating.
+//
+void Sweep_Lazily(void)
+{
+    while (SER_USED(GC_Unswept) != 0) {
+      #if defined(DEBUG_CHECK_LAZY_SWEEP)
+        Check_Lazy_Sweep_Debug();
+      #endif
+
+        GC_Stats.Freed += Sweep_Unswept_Segment();
+        if (Mem_Pools[SER_POOL].first)
+            break;  // has units to hand out again
+    }
+}
+
+
+//
+//  Signal_Lazy_Sweep: C
+//
+// Out-of-line so %sys-node.h doesn't need SET_SIGNAL().
+//
+void Signal_Lazy_Sweep(void)
+{
+    SET_SIGNAL(SIG_SWEEP);
+}
+
+
+//
+//  Finish_Lazy_Sweep: C
+//
+// Sweep whatever segments a lazy sweep has left.  This has to be done before
+// the next recycle can use the mark bits.
+//
+static REBLEN Finish_Lazy_Sweep(void)
+{
+    REBLEN count = 0;
+    while (SER_USED(GC_Unswept) != 0)
+        count += Sweep_Unswept_Segment();
+    return count;
+}
+
+
+//
+//  Is_Node_Unswept: C
+//
+// Binary search of the (sorted) segments that the lazy sweep hasn't reached,
+// plus a check of the rest of the segment being swept, if any.
+//
+bool Is_Node_Unswept(const void *node)
+{
+    uintptr_t addr = cast(uintptr_t, node);
+
+    if (
+        addr >= cast(uintptr_t, sweep_cursor)
+        and addr < cast(uintptr_t, sweep_limit)
+    ){
+        return true;
+    }
+
+    REBSEG **segs = SER_HEAD(REBSEG*, GC_Unswept);
+    REBLEN lo = 0;
+    REBLEN hi = SER_USED(GC_Unswept);
+    while (lo < hi) {
+        REBLEN mid = lo + (hi - lo) / 2;
+        uintptr_t start = cast(uintptr_t, segs[mid]);
+        if (addr < start)
+            hi = mid;
+        else if (addr >= start + segs[mid]->size)
+            lo = mid + 1;
+        else
+            return true;
+    }
+    return false;
+}
+
+
+//
+//  Keep_Unswept_Node: C
+//
+// Out-of-line part of Keep_From_Lazy_Sweep().
+//
+void Keep_Unswept_Node(const void *node)
+{
+    REBYTE *unit = m_cast(REBYTE*, cast(const REBYTE*, node));
+    assert(*unit & NODE_BYTEMASK_0x20_MANAGED);
+
+    if (not (*unit & NODE_BYTEMASK_0x10_MARKED) and Is_Node_Unswept(node))
+        *unit |= NODE_BYTEMASK_0x10_MARKED;
+}
+
+
 #if !defined(NDEBUG)
 
 //
@@ -1061,15 +1461,193 @@ REBLEN Fill_Sweeplist(REBSER *sweeplist)
 #endif
 
 
+// CPU time in microseconds.  Time the process spends blocked isn't counted,
+// which is what's wanted for measuring pauses and the time between recycles.
 //
-//  Recycle_Core: C
+static REBI64 GC_Clock_Usec(void)
+{
+    return cast(REBI64, clock()) * 1000000 / CLOCKS_PER_SEC;
+}
+
+
+//
+//  Get_GC_Pacing: C
+//
+// A pacing setting from SYSTEM/OPTIONS (e.g. OPTIONS_GC_GROWTH), or the value
+// given by R3_GC_PACING (or 0) if that isn't a non-negative INTEGER!.
+//
+REBI64 Get_GC_Pacing(REBLEN field)
+{
+    REBLEN env_default;
+    switch (field) {
+      case OPTIONS_GC_GROWTH: env_default = GC_Pace_Growth; break;
+      case OPTIONS_GC_PAUSE: env_default = GC_Pace_Pause; break;
+      case OPTIONS_GC_INTERVAL: env_default = GC_Pace_Interval; break;
+      default: panic ("Get_GC_Pacing() called on a non-pacing option");
+    }
+
+    if (PG_Boot_Phase < BOOT_ERRORS)  // system object not made yet
+        return env_default;
+
+    REBVAL *options = CTX_VAR(VAL_CONTEXT(Root_System), SYS_OPTIONS);
+    REBVAL *v = CTX_VAR(VAL_CONTEXT(options), field);
+    if (not IS_INTEGER(v) or VAL_INT64(v) < 0)
+        return env_default;
+    return VAL_INT64(v);
+}
+
+
+// Decide how much can be allocated before the next automatic recycle:
+//
+// * TG_Ballast to start with (MEM_BALLAST, or set by RECYCLE/BALLAST)
+//
+// * If `gc-growth` is set, at least that percentage of the memory that's in
+//   use after this recycle.  So a big heap isn't recycled as often as a
+//   small one, and the time spent recycling stays proportional.
+//
+// * If `gc-pause` (msec) is set and this recycle took longer, that times
+//   (up to 8 times) as much.  A long pause can't be made shorter, but fewer
+//   of them can be had in exchange for memory.
+//
+// RECYCLE/TORTURE (a TG_Ballast of 0) is left alone.
+//
+static void Pace_Next_Recycle(REBI64 pause)
+{
+    GC_Last_Pause = pause;
+    GC_Last_End = GC_Clock_Usec();
+    GC_Deferred_In_Row = 0;
+
+    REBI64 ballast = TG_Ballast;
+    GC_Pace_Decision = "ballast";
+
+    if (ballast != 0) {
+        REBI64 growth = Get_GC_Pacing(OPTIONS_GC_GROWTH);
+        if (growth != 0) {
+            REBI64 target = cast(REBI64, PG_Mem_Usage / 100) * growth;
+            if (target > ballast) {
+                ballast = target;
+                GC_Pace_Decision = "growth";
+            }
+        }
+
+        REBI64 budget = Get_GC_Pacing(OPTIONS_GC_PAUSE) * 1000;
+        if (budget != 0 and pause > budget) {
+            REBI64 factor = pause / budget + 1;
+            ballast *= factor > 8 ? 8 : factor;
+            GC_Pace_Decision = "pause";
+        }
+
+        if (ballast > INT32_MAX)
+            ballast = INT32_MAX;
+    }
+
+    GC_Ballast = cast(REBINT, ballast);
+    GC_Paced_Ballast = ballast;
+}
+
+
+// Update the counters reported by STATS/GC.  A lazy recycle's sweep time is
+// only what it took to get started, as the rest is spread over allocations.
+//
+static void Note_Recycle_Stats(
+    REBI64 mark_usec,
+    REBI64 sweep_usec,
+    REBLEN freed
+){
+    ++GC_Stats.Recycles;
+
+    GC_Stats.Last_Mark_Usec = mark_usec;
+    GC_Stats.Last_Sweep_Usec = sweep_usec;
+    GC_Stats.Mark_Usec += mark_usec;
+    GC_Stats.Sweep_Usec += sweep_usec;
+
+    REBI64 pause = mark_usec + sweep_usec;
+    if (pause > GC_Stats.Max_Pause_Usec)
+        GC_Stats.Max_Pause_Usec = pause;
+
+    REBLEN bucket = 0;  // 100us, then each bucket is 10x the one before
+    REBI64 limit = 100;
+    for (; bucket < GC_PAUSE_BUCKETS - 1 and pause >= limit; ++bucket)
+        limit *= 10;
+    ++GC_Stats.Pauses[bucket];
+
+    GC_Stats.Marked += GC_Stats.Last_Marked;
+    GC_Stats.Last_Freed = freed;
+    GC_Stats.Freed += freed;
+}
+
+
+//
+//  Is_Recycle_Too_Soon: C
+//
+// If `gc-interval` (msec) is set, automatic recycles won't come closer than
+// that together.  When the ballast runs out sooner, this gives another one
+// and returns true so the signal handler can skip the recycle.
+//
+// Each deferral lets another ballast's worth be allocated, so a program that
+// allocates fast enough would never recycle.  After GC_MAX_DEFERRALS in a
+// row, the recycle runs anyway.
+//
+bool Is_Recycle_Too_Soon(void)
+{
+    REBI64 interval = Get_GC_Pacing(OPTIONS_GC_INTERVAL);
+    if (interval == 0 or TG_Ballast == 0)
+        return false;
+
+    if (GC_Clock_Usec() - GC_Last_End >= interval * 1000)
+        return false;
+
+    if (GC_Deferred_In_Row >= GC_MAX_DEFERRALS)
+        return false;
+
+    GC_Ballast = GC_Paced_Ballast;
+    ++GC_Deferred;
+    ++GC_Deferred_In_Row;
+    return true;
+}
+
+
+// MARKING PHASE: the "root set" from which we determine the liveness
+// (or deadness) of a series.  If we are shutting down, we do not mark
+// several categories of series...but we do need to run the root marking.
+// (In particular because that is when API series whose lifetimes
+// are bound to frames will be freed, if the frame is expired.)
+//
+static void Mark_Live_Nodes(bool shutdown)
+{
+    Mark_Root_Series();
+
+    if (not shutdown) {
+        Mark_Natives();
+        Mark_Symbol_Series();
+
+        Mark_Data_Stack();
+
+        Mark_Guarded_Nodes();
+
+        Mark_Frame_Stack_Deep();
+
+        Propagate_All_GC_Marks();
+
+        Mark_Devices_Deep();
+    }
+}
+
+
+//
+//  Recycle_Maybe_Lazy_Core: C
 //
 // Recycle memory no longer needed.  If sweeplist is not NULL, then it needs
 // to be a series whose width is sizeof(REBSER*), and it will be filled with
 // the list of series that *would* be recycled.
 //
-REBLEN Recycle_Core(bool shutdown, REBSER *sweeplist)
-{
+// If `lazy` is true then the SER_POOL isn't swept, see Start_Lazy_Sweep().
+//
+static REBLEN Recycle_Maybe_Lazy_Core(
+    bool lazy,
+    bool shutdown,
+    REBSER *sweeplist
+){
     // Ordinarily, it should not be possible to spawn a recycle during a
     // recycle.  But when debug code is added into the recycling code, it
     // could cause a recursion.  Be tolerant of such recursions to make that
@@ -1101,6 +1679,21 @@ REBLEN Recycle_Core(bool shutdown, REBSER *sweeplist)
         return 0;
     }
 
+    REBI64 start = GC_Clock_Usec();
+
+    // Virtual binding patches may be freed, so the lookups cached for them
+    // can't be trusted after this (see TG_Virtual_Cache).
+    //
+    ++TG_Virtual_Cache_Generation;
+
+    // If the last recycle was lazy, the marks it left on the nodes that
+    // haven't been swept have to be taken off before marking again.
+    //
+    REBLEN count = Finish_Lazy_Sweep();
+
+    REBI64 mark_start = GC_Clock_Usec();
+    GC_Stats.Last_Marked = 0;
+
   #if !defined(NDEBUG)
     GC_Recycling = true;
   #endif
@@ -1124,35 +1717,16 @@ REBLEN Recycle_Core(bool shutdown, REBSER *sweeplist)
         GC_Kill_Series(varlist); // no track for Free_Unmanaged_Series()
     }
 
-    // MARKING PHASE: the "root set" from which we determine the liveness
-    // (or deadness) of a series.  If we are shutting down, we do not mark
-    // several categories of series...but we do need to run the root marking.
-    // (In particular because that is when API series whose lifetimes
-    // are bound to frames will be freed, if the frame is expired.)
-    //
-    Mark_Root_Series();
-
-    if (not shutdown) {
-        Mark_Natives();
-        Mark_Symbol_Series();
+    assert(not lazy or (not shutdown and not sweeplist));
 
-        Mark_Data_Stack();
+    Mark_Live_Nodes(shutdown);
 
-        Mark_Guarded_Nodes();
-
-        Mark_Frame_Stack_Deep();
-
-        Propagate_All_GC_Marks();
-
-        Mark_Devices_Deep();
-    }
+    REBI64 sweep_start = GC_Clock_Usec();
 
     // SWEEPING PHASE
 
     ASSERT_NO_GC_MARKS_PENDING();
 
-    REBLEN count = 0;
-
     if (sweeplist != NULL) {
     #if defined(NDEBUG)
         panic (sweeplist);
@@ -1160,9 +1734,21 @@ REBLEN Recycle_Core(bool shutdown, REBSER *sweeplist)
         count += Fill_Sweeplist(sweeplist);
     #endif
     }
+    else if (lazy) {
+        Start_Lazy_Sweep();
+      #ifdef UNUSUAL_REBVAL_SIZE
+        count += Sweep_Pairings();
+      #endif
+    }
     else
         count += Sweep_Series();
 
+    Note_Recycle_Stats(
+        sweep_start - mark_start,
+        (mark_start - start) + (GC_Clock_Usec() - sweep_start),
+        count
+    );
+
   #if defined(DEBUG_COLLECT_STATS)
     // Compute new stats:
     PG_Reb_Stats->Recycle_Series
@@ -1182,8 +1768,10 @@ REBLEN Recycle_Core(bool shutdown, REBSER *sweeplist)
     // Reverted to the R3-Alpha state, accommodating a comment "do not adjust
     // task variables or boot strings in shutdown when they are being freed."
     //
+    // (The pacing settings may now give more than TG_Ballast.)
+    //
     if (not shutdown)
-        GC_Ballast = TG_Ballast;
+        Pace_Next_Recycle(GC_Clock_Usec() - start);
 
     ASSERT_NO_GC_MARKS_PENDING();
 
@@ -1199,7 +1787,11 @@ REBLEN Recycle_Core(bool shutdown, REBSER *sweeplist)
     // stack, so calling into the evaluator e.g. for rebPrint() may be bad.
     //
     if (Reb_Opts->watch_recycle) {
-        printf("RECYCLE: %u nodes\n", cast(unsigned int, count));
+        printf(
+            "RECYCLE%s: %u nodes\n",
+            lazy ? " (lazy)" : "",
+            cast(unsigned int, count)
+        );
         fflush(stdout);
     }
   #endif
@@ -1208,6 +1800,17 @@ REBLEN Recycle_Core(bool shutdown, REBSER *sweeplist)
 }
 
 
+//
+//  Recycle_Core: C
+//
+// Full recycle, which considers every node in the system.
+//
+REBLEN Recycle_Core(bool shutdown, REBSER *sweeplist)
+{
+    return Recycle_Maybe_Lazy_Core(false, shutdown, sweeplist);
+}
+
+
 //
 //  Recycle: C
 //
@@ -1234,6 +1837,18 @@ REBLEN Recycle(void)
 }
 
 
+//
+//  Recycle_Lazy: C
+//
+// Full recycle that only does the marking, leaving the SER_POOL to be swept a
+// segment at a time between evaluator steps (see Sweep_Lazily()).
+//
+REBLEN Recycle_Lazy(void)
+{
+    return Recycle_Maybe_Lazy_Core(true, false, nullptr);
+}
+
+
 //
 //  Push_Guard_Node: C
 //
@@ -1300,6 +1915,52 @@ void Startup_GC(void)
     // nested structures don't cause the C stack to overflow.
     //
     GC_Mark_Stack = Make_Series(100, FLAG_FLAVOR(NODELIST));
+
+    // Lazy sweeping is off by default, see RECYCLE/LAZY.  The environment
+    // variable is useful for running test suites with it.
+    //
+    GC_Lazy_Sweep = false;
+    GC_Sweep_Pending = false;
+    GC_Unswept = Make_Series(15, FLAG_FLAVOR(NODELIST));
+
+    const char *env_lazy = getenv("R3_GC_LAZY_SWEEP");
+    if (env_lazy and atoi(env_lazy) != 0)
+        GC_Lazy_Sweep = true;
+
+    // Giving back segments of pools that empty out after automatic recycles
+    // is off by default too.  See Trim_Pools() for the hysteresis that keeps
+    // it from thrashing when it is on.  (RECYCLE/TRIM always trims.)
+    //
+    GC_Auto_Trim = false;
+
+    const char *env_trim = getenv("R3_GC_AUTO_TRIM");
+    if (env_trim and atoi(env_trim) != 0)
+        GC_Auto_Trim = true;
+
+    // R3_GC_PACING is "growth,pause,interval" (e.g. "100,20,10") to set the
+    // defaults of SYSTEM/OPTIONS/GC-GROWTH etc, see Pace_Next_Recycle().
+    //
+    GC_Pace_Growth = 0;
+    GC_Pace_Pause = 0;
+    GC_Pace_Interval = 0;
+    GC_Pace_Decision = "ballast";
+    GC_Paced_Ballast = MEM_BALLAST;
+    GC_Last_Pause = 0;
+    GC_Last_End = 0;
+    GC_Deferred = 0;
+    GC_Deferred_In_Row = 0;
+
+    memset(&GC_Stats, 0, sizeof(GC_Stats));
+
+    const char *env_pacing = getenv("R3_GC_PACING");
+    if (env_pacing) {
+        char *end;
+        GC_Pace_Growth = strtoul(env_pacing, &end, 10);
+        if (*end == ',')
+            GC_Pace_Pause = strtoul(end + 1, &end, 10);
+        if (*end == ',')
+            GC_Pace_Interval = strtoul(end + 1, &end, 10);
+    }
 }
 
 
@@ -1310,6 +1971,10 @@ void Shutdown_GC(void)
 {
     Free_Unmanaged_Series(GC_Guarded);
     Free_Unmanaged_Series(GC_Mark_Stack);
+
+    assert(not GC_Sweep_Pending);  // shutdown recycle finished any lazy sweep
+    GC_Lazy_Sweep = false;
+    Free_Unmanaged_Series(GC_Unswept);
 }
 
 
@@ -59,9 +59,33 @@
 // R3_ALWAYS_MALLOC to 1.
 //
 
+// mremap() is a Linux extension, see feature_test_macros(7).  This definition
+// is redundant under C++.
+//
+#if defined(TO_LINUX) && !defined(__cplusplus)
+    #define _GNU_SOURCE
+#endif
+
+// malloc_trim() is declared by glibc's <malloc.h>, which brings in <stdio.h>.
+// That has to be included before %sys-core.h (see %file-posix.c).  Any libc
+// header will tell if this is glibc, <limits.h> is used for that here.
+//
+#if defined(TO_LINUX)
+    #include <limits.h>
+    #if defined(__GLIBC__)
+        #define REBOL_ALLOW_STDIO_IN_RELEASE_BUILD
+        #include <malloc.h>
+    #endif
+#endif
+
 #include "sys-core.h"
 #include "sys-int-funcs.h"
 
+#if !defined(TO_WINDOWS)
+    #include <sys/mman.h>  // for madvise()
+    #include <unistd.h>  // for sysconf()
+#endif
+
 
 //
 //  Try_Alloc_Mem: C
@@ -171,6 +195,132 @@ void Free_Mem(void *mem, size_t size)
 }
 
 
+#if defined(MMAP_LARGE_SERIES)
+
+// Transparent huge pages can cut the TLB misses from walking through a large
+// series, but the kernel may only use them for memory that asks.
+//
+static void Advise_Huge_Pages(void *p, size_t size)
+{
+  #if defined(MADV_HUGEPAGE)
+    if (PG_Huge_Pages and size >= MEM_HUGE_PAGE_SIZE)
+        madvise(p, size, MADV_HUGEPAGE);  // only advice, so ignore failure
+  #else
+    UNUSED(p);
+    UNUSED(size);
+  #endif
+}
+
+
+//
+//  Try_Alloc_Large: C
+//
+// Series data of MEM_LARGE_SIZE or more gets its own mapping from the OS,
+// instead of coming from malloc().  Freeing it gives the memory right back,
+// and on Linux it can be grown without copying (see Try_Grow_Large_Series()).
+// The size must be a multiple of the page size (see Round_Large_Size()).
+//
+void *Try_Alloc_Large(size_t size)
+{
+    assert(size % PG_Page_Size == 0);
+
+    void *p = mmap(
+        nullptr,
+        size,
+        PROT_READ | PROT_WRITE,
+        MAP_PRIVATE | MAP_ANONYMOUS,
+        -1,
+        0
+    );
+    if (p == MAP_FAILED)
+        return nullptr;
+
+    Advise_Huge_Pages(p, size);
+
+    PG_Mem_Usage += size;
+    return p;
+}
+
+
+//
+//  Free_Large: C
+//
+void Free_Large(void *p, size_t size)
+{
+    assert(size % PG_Page_Size == 0);
+
+    munmap(p, size);
+    PG_Mem_Usage -= size;
+}
+
+
+//
+//  Try_Make_Mapped_Binary: C
+//
+// Make a BINARY! whose data is a private mapping of `size` bytes from the
+// open file `fd`, starting at `offset` (which must be a multiple of the page
+// size).  The data is laid out just like a large series from Try_Alloc_Large()
+// so freeing the series unmaps it.  The binary is frozen, so the pages of the
+// file are never copied on write.
+//
+// Returns nullptr if the file can't be mapped, or if the data would not be
+// big enough to be freed as a large series.  Callers should read the file
+// normally in that case.
+//
+// !!! "Frozen" only means this process won't change the data.  Pages that
+// haven't been copied still show writes to the file by other processes, and
+// if the file is truncated while mapped, reading past the new end raises
+// SIGBUS.  So mapping is only done when asked for (READ/MAP), never by LOAD.
+//
+REBBIN *Try_Make_Mapped_Binary(int fd, REBI64 offset, REBLEN size)
+{
+    if (offset % PG_Page_Size != 0)
+        return nullptr;
+
+    size_t total = Round_Large_Size(size + 1);  // room for the terminator
+    if (total < MEM_LARGE_SIZE or total > INT32_MAX)
+        return nullptr;
+
+    // Reserve the whole allocation as zeroed anonymous pages first, then put
+    // the file over the front of it.  That way whatever follows the file's
+    // last byte is zero, and the terminator always has somewhere to go.
+    //
+    char *p = cast(char*, Try_Alloc_Large(total));
+    if (not p)
+        return nullptr;
+
+    if (mmap(
+        p,
+        size,
+        PROT_READ | PROT_WRITE,
+        MAP_PRIVATE | MAP_FIXED,
+        fd,
+        offset
+    ) == MAP_FAILED){
+        Free_Large(p, total);
+        return nullptr;
+    }
+
+    REBBIN *bin = Make_Binary_Core(0, SERIES_FLAG_DYNAMIC);
+    Free_Unbiased_Series_Data(bin->content.dynamic.data, SER_TOTAL(bin));
+
+    bin->content.dynamic.data = p;
+    bin->content.dynamic.rest = total;
+    SER_SET_BIAS(bin, 0);
+
+    Mem_Pools[SYSTEM_POOL].has += total;
+    Mem_Pools[SYSTEM_POOL].free++;
+    if ((GC_Ballast -= total) <= 0)
+        SET_SIGNAL(SIG_RECYCLE);
+
+    TERM_BIN_LEN(bin, size);
+    Freeze_Series(bin);
+    return bin;
+}
+
+#endif
+
+
 /***********************************************************************
 **
 **  MEMORY POOLS
@@ -239,6 +389,13 @@ const REBPOOLSPEC Mem_Pool_Spec[MAX_POOLS] =
 //
 void Startup_Pools(REBINT scale)
 {
+  #if defined(MMAP_LARGE_SERIES)
+    PG_Page_Size = sysconf(_SC_PAGESIZE);
+
+    const char *env_huge_pages = getenv("R3_HUGE_PAGES");
+    PG_Huge_Pages = (env_huge_pages and atoi(env_huge_pages) != 0);
+  #endif
+
   #ifdef DEBUG_ENABLE_ALWAYS_MALLOC
     const char *env_always_malloc = getenv("R3_ALWAYS_MALLOC");
     if (env_always_malloc and atoi(env_always_malloc) != 0)
@@ -321,6 +478,15 @@ void Startup_Pools(REBINT scale)
     );
     CLEAR_SERIES_FLAG(GC_Manuals, MANAGED);
 
+    // Unmanaged API arrays whose lifetime isn't tied to a frame or to the
+    // manuals list, but whose cells must still be marked.  (Same trick.)
+    //
+    GC_Roots = Make_Series(
+        15,
+        FLAG_FLAVOR(SERIESLIST) | NODE_FLAG_MANAGED
+    );
+    CLEAR_SERIES_FLAG(GC_Roots, MANAGED);
+
     Prior_Expand = TRY_ALLOC_N(REBSER*, MAX_EXPAND_LIST);
     memset(Prior_Expand, 0, sizeof(REBSER*) * MAX_EXPAND_LIST);
     Prior_Expand[0] = (REBSER*)1;
@@ -338,6 +504,7 @@ void Shutdown_Pools(void)
     // the manuals list...
     //
     GC_Kill_Series(GC_Manuals);
+    GC_Kill_Series(GC_Roots);
 
   #if !defined(NDEBUG)
     int num_leaks = 0;
@@ -375,6 +542,10 @@ void Shutdown_Pools(void)
     }
   #endif
 
+  #if defined(NODE_MAGAZINES)
+    memset(TG_Magazines, 0, sizeof(TG_Magazines));  // units are in segments
+  #endif
+
     REBLEN pool_num;
     for (pool_num = 0; pool_num < MAX_POOLS; pool_num++) {
         REBPOL *pool = &Mem_Pools[pool_num];
@@ -477,6 +648,370 @@ bool Try_Fill_Pool(REBPOL *pool)
 }
 
 
+#if defined(NODE_MAGAZINES)
+
+#include <pthread.h>
+
+__thread REBMAG TG_Magazines[SYSTEM_POOL];
+
+// Guards the free lists (and `free` counts) of the pools while units move
+// between them and the magazines.  Code that only runs on the interpreter
+// thread while other threads aren't allocating (recycling, sweeping, series
+// data expansion) still touches the free lists without taking it.
+//
+static pthread_mutex_t Pools_Mutex = PTHREAD_MUTEX_INITIALIZER;
+
+
+//
+//  Try_Refill_Magazine: C
+//
+// Called when the calling thread's magazine for a pool is empty.  Moves half
+// a magazine of units from the pool's free list into it, adding a segment to
+// the pool if there are no free units.  Returns false if out of memory.
+//
+bool Try_Refill_Magazine(REBLEN pool_id)
+{
+    REBPOL *pool = &Mem_Pools[pool_id];
+    REBMAG *mag = &TG_Magazines[pool_id];
+    assert(mag->count == 0);
+
+    // Only the interpreter thread can get here with a sweep pending, as other
+    // threads (NODE-ALLOC-BENCHMARK's) only allocate when there isn't one.
+    //
+    if (pool_id == SER_POOL and GC_Sweep_Pending and not pool->first)
+        Signal_Lazy_Sweep();  // not safe to sweep here, see Sweep_Lazily()
+
+    pthread_mutex_lock(&Pools_Mutex);
+
+    if (not pool->first and not Try_Fill_Pool(pool)) {
+        pthread_mutex_unlock(&Pools_Mutex);
+        return false;
+    }
+
+    for (; mag->count < MAGAZINE_SIZE / 2 and pool->first; ++mag->count) {
+        REBPLU *unit = pool->first;
+        pool->first = unit->next_if_free;
+        if (unit == pool->last)
+            pool->last = nullptr;
+        --pool->free;
+
+        mag->units[mag->count] = unit;
+    }
+
+    pthread_mutex_unlock(&Pools_Mutex);
+    return true;
+}
+
+
+//
+//  Return_Magazine_Units: C
+//
+// Called when the calling thread's magazine for a pool is full.  Gives the
+// units in the bottom half of it back to the pool's free list.  (The units
+// on top are the most recently freed, so they're kept as the likeliest to
+// still be in the cache.)
+//
+void Return_Magazine_Units(REBLEN pool_id)
+{
+    REBPOL *pool = &Mem_Pools[pool_id];
+    REBMAG *mag = &TG_Magazines[pool_id];
+
+    REBLEN half = mag->count / 2;
+
+    pthread_mutex_lock(&Pools_Mutex);
+
+    REBLEN n;
+    for (n = 0; n < half; ++n) {
+        REBPLU *unit = mag->units[n];
+        if (not pool->first)
+            pool->last = unit;
+        unit->next_if_free = pool->first;
+        pool->first = unit;
+        ++pool->free;
+    }
+
+    pthread_mutex_unlock(&Pools_Mutex);
+
+    memmove(
+        &mag->units[0],
+        &mag->units[half],
+        sizeof(REBPLU*) * (mag->count - half)
+    );
+    mag->count -= half;
+}
+
+
+//
+//  Flush_Magazines: C
+//
+// Give all the units in the calling thread's magazines back to the pools.
+// Threads other than the interpreter's must do this before they exit.
+//
+void Flush_Magazines(void)
+{
+    pthread_mutex_lock(&Pools_Mutex);
+
+    REBLEN pool_id;
+    for (pool_id = 0; pool_id < SYSTEM_POOL; ++pool_id) {
+        REBPOL *pool = &Mem_Pools[pool_id];
+        REBMAG *mag = &TG_Magazines[pool_id];
+
+        for (; mag->count != 0; --mag->count) {
+            REBPLU *unit = mag->units[mag->count - 1];
+            if (not pool->first)
+                pool->last = unit;
+            unit->next_if_free = pool->first;
+            pool->first = unit;
+            ++pool->free;
+        }
+    }
+
+    pthread_mutex_unlock(&Pools_Mutex);
+}
+
+#endif
+
+
+//
+//  Compare_Segments: C
+//
+// Qsort comparator putting segments in order of address, so the segment a
+// unit is in can be found with a binary search (see Find_Segment_Index()).
+//
+int Compare_Segments(void *thunk, const void *v1, const void *v2)
+{
+    UNUSED(thunk);
+
+    uintptr_t seg1 = cast(uintptr_t, *cast(REBSEG* const*, v1));
+    uintptr_t seg2 = cast(uintptr_t, *cast(REBSEG* const*, v2));
+    if (seg1 < seg2)
+        return -1;
+    return seg1 > seg2 ? 1 : 0;
+}
+
+
+// Index of the segment holding a unit, in segments sorted by address.
+//
+static REBLEN Find_Segment_Index(REBSEG **segs, REBLEN num_segs, void *unit)
+{
+    REBLEN lo = 0;
+    REBLEN hi = num_segs;
+    while (hi - lo > 1) {  // find the last segment starting at or before unit
+        REBLEN mid = lo + (hi - lo) / 2;
+        if (cast(REBYTE*, segs[mid]) <= cast(REBYTE*, unit))
+            lo = mid;
+        else
+            hi = mid;
+    }
+    assert(cast(REBYTE*, segs[lo]) < cast(REBYTE*, unit));
+    assert(cast(REBYTE*, unit) < cast(REBYTE*, segs[lo]) + segs[lo]->size);
+    return lo;
+}
+
+
+// Free the segments of a pool which have no units in use, so long as that
+// leaves at least `reserve` free units.  The pool has no record of which
+// segment a unit is in, so the free units are counted per segment by going
+// through the free list.  Returns the number of bytes freed.
+//
+static REBLEN Trim_Pool(REBPOL *pool, REBLEN reserve)
+{
+    REBLEN num_segs = 0;
+    REBSEG *seg;
+    for (seg = pool->segs; seg != nullptr; seg = seg->next)
+        ++num_segs;
+
+    if (num_segs == 0)
+        return 0;
+
+    REBSEG **segs = TRY_ALLOC_N(REBSEG*, num_segs);
+    if (not segs)
+        return 0;  // trimming is an optimization, so not an error
+
+    REBLEN *counts = TRY_ALLOC_N(REBLEN, num_segs);
+    if (not counts) {
+        FREE_N(REBSEG*, num_segs, segs);
+        return 0;
+    }
+
+    REBLEN i = 0;
+    for (seg = pool->segs; seg != nullptr; seg = seg->next)
+        segs[i++] = seg;
+    reb_qsort_r(segs, num_segs, sizeof(REBSEG*), nullptr, &Compare_Segments);
+
+    memset(counts, 0, sizeof(REBLEN) * num_segs);
+
+    REBPLU *unit;
+    for (unit = pool->first; unit != nullptr; unit = unit->next_if_free)
+        ++counts[Find_Segment_Index(segs, num_segs, unit)];
+
+    // Reuse the counts as the verdicts: 1 to free the segment, 0 to keep it.
+    //
+    REBLEN free_units = pool->free;
+    REBLEN num_freeing = 0;
+    for (i = 0; i < num_segs; ++i) {
+        if (
+            counts[i] == pool->num_units
+            and free_units >= reserve + pool->num_units
+        ){
+            counts[i] = 1;
+            free_units -= pool->num_units;
+            ++num_freeing;
+        }
+        else
+            counts[i] = 0;
+    }
+
+    REBLEN mem_size = pool->wide * pool->num_units + sizeof(REBSEG);
+
+    if (num_freeing != 0) {
+        //
+        // Rebuild the free list without the units in the freed segments (in
+        // the same order, as the debug build relies on freed units not being
+        // reused right away).
+        //
+        REBPLU *first = nullptr;
+        REBPLU *last = nullptr;
+        unit = pool->first;
+        while (unit != nullptr) {
+            REBPLU *next = unit->next_if_free;
+            if (counts[Find_Segment_Index(segs, num_segs, unit)] == 0) {
+                if (last)
+                    last->next_if_free = unit;
+                else
+                    first = unit;
+                last = unit;
+            }
+            unit = next;
+        }
+        if (last)
+            last->next_if_free = nullptr;
+
+        pool->first = first;
+        pool->last = last;
+        pool->free = free_units;
+
+        REBSEG **link = &pool->segs;
+        while (*link) {
+            seg = *link;
+            if (counts[Find_Segment_Index(segs, num_segs, seg + 1)] == 0) {
+                link = &seg->next;
+                continue;
+            }
+            *link = seg->next;
+            FREE_N(char, mem_size, cast(char*, seg));
+            pool->has -= pool->num_units;
+        }
+    }
+
+    FREE_N(REBLEN, num_segs, counts);
+    FREE_N(REBSEG*, num_segs, segs);
+
+    return num_freeing * mem_size;
+}
+
+
+//
+//  Trim_Pools: C
+//
+// Free pool segments that have no units in use.  If `all` is false then this
+// is the automatic policy run after recycles, which only trims a pool when
+// more than half its units are free, and keeps half as many free units as
+// there are used ones (plus a segment's worth) so a pool whose usage swings
+// up and down doesn't keep freeing and refilling segments.
+//
+// Returns the number of bytes freed.
+//
+REBLEN Trim_Pools(bool all)
+{
+  #if defined(NODE_MAGAZINES)
+    Flush_Magazines();  // units in magazines aren't on the free lists
+  #endif
+
+    REBLEN trimmed = 0;
+
+    REBLEN pool_id;
+    for (pool_id = 0; pool_id < SYSTEM_POOL; ++pool_id) {
+        if (pool_id == SER_POOL and GC_Sweep_Pending)
+            continue;  // segments can't move out from under the sweep
+
+        REBPOL *pool = &Mem_Pools[pool_id];
+        REBLEN used = pool->has - pool->free;
+
+        REBLEN reserve;
+        if (all)
+            reserve = 0;
+        else {
+            if (pool->free <= used or pool->free < 2 * pool->num_units)
+                continue;
+            reserve = used / 2 + pool->num_units;
+        }
+
+        trimmed += Trim_Pool(pool, reserve);
+    }
+
+  #if defined(__GLIBC__)
+    if (trimmed != 0)
+        malloc_trim(0);  // segments are small enough for malloc to keep
+  #endif
+
+    return trimmed;
+}
+
+
+//
+//  Trim_Series_Data: C
+//
+// Tell the OS it can take back the pages of unused capacity in large BINARY!
+// and TEXT! data (e.g. after a CLEAR), which it will give back zero-filled if
+// they are written again.  Only data at least a page past the tail of the
+// series is affected.  Data in pools is not, nor is array data (whose unused
+// cells must be kept formatted).
+//
+// Returns the number of bytes given back.
+//
+REBLEN Trim_Series_Data(void)
+{
+  #if defined(TO_WINDOWS)
+    return 0;  // !!! could use DiscardVirtualMemory() or MEM_RESET
+  #else
+    uintptr_t page = sysconf(_SC_PAGESIZE);
+    REBLEN trimmed = 0;
+
+    REBSEG *seg = Mem_Pools[SER_POOL].segs;
+    for (; seg != nullptr; seg = seg->next) {
+        REBYTE *unit = cast(REBYTE*, seg + 1);
+        REBLEN n = Mem_Pools[SER_POOL].num_units;
+        for (; n > 0; --n, unit += sizeof(REBSER)) {
+            if (*unit & (NODE_BYTEMASK_0x40_FREE | NODE_BYTEMASK_0x01_CELL))
+                continue;  // free, or a pairing
+
+            REBSER *s = SER(cast(void*, unit));
+            if (not IS_SER_DYNAMIC(s) or SER_WIDE(s) != 1)
+                continue;
+
+            if (FIND_POOL(SER_TOTAL(s)) < SYSTEM_POOL)
+                continue;
+
+            REBYTE *unbiased = SER_DATA(s) - SER_BIAS(s);
+            uintptr_t tail = cast(uintptr_t, SER_DATA(s) + SER_USED(s) + 1);
+            uintptr_t start = (tail + page - 1) & ~(page - 1);
+            uintptr_t end = cast(uintptr_t, unbiased + SER_TOTAL(s))
+                & ~(page - 1);
+
+            if (end <= start)
+                continue;
+
+            if (0 == madvise(cast(void*, start), end - start, MADV_DONTNEED))
+                trimmed += end - start;
+        }
+    }
+
+    return trimmed;
+  #endif
+}
+
+
 #if defined(DEBUG_FANCY_PANIC)
 
 //
@@ -594,6 +1129,7 @@ REBVAL *Alloc_Pairing(void) {
 //
 void Manage_Pairing(REBVAL *paired) {
     SET_CELL_FLAG(paired, MANAGED);
+    Keep_From_Lazy_Sweep(paired);
 }
 
 
@@ -645,7 +1181,6 @@ void Free_Pairing(REBVAL *paired) {
 void Free_Unbiased_Series_Data(char *unbiased, REBLEN total)
 {
     REBLEN pool_num = FIND_POOL(total);
-    REBPOL *pool;
 
     if (pool_num < SYSTEM_POOL) {
         //
@@ -658,21 +1193,85 @@ void Free_Unbiased_Series_Data(char *unbiased, REBLEN total)
 
         assert(Mem_Pools[pool_num].wide >= total);
 
-        pool = &Mem_Pools[pool_num];
+      #if defined(NODE_MAGAZINES)
+        Free_Node(pool_num, cast(REBNOD*, unit));  // into this thread's magazine
+      #else
+        REBPOL *pool = &Mem_Pools[pool_num];
         unit->next_if_free = pool->first;
         pool->first = unit;
         pool->free++;
 
         mutable_FIRST_BYTE(unit->headspot) = FREED_SERIES_BYTE;
+      #endif
     }
     else {
-        FREE_N(char, total, unbiased);
+      #if defined(MMAP_LARGE_SERIES)
+        if (Is_Large_Size(total))
+            Free_Large(unbiased, Round_Large_Size(total));
+        else
+      #endif
+            FREE_N(char, total, unbiased);
+
         Mem_Pools[SYSTEM_POOL].has -= total;
         Mem_Pools[SYSTEM_POOL].free++;
     }
 }
 
 
+#if defined(HAS_MREMAP)
+
+// Give a large series more capacity with mremap(), which can move the pages
+// to a new address if need be but never copies them.  Only done for series
+// with no bias, so the data stays at the head of the allocation.
+//
+static bool Try_Grow_Large_Series(REBSER *s, REBLEN capacity)
+{
+    assert(IS_SER_DYNAMIC(s) and SER_BIAS(s) == 0);
+
+    REBYTE wide = SER_WIDE(s);
+    size_t total_old = SER_TOTAL(s);
+    if (not Is_Large_Size(total_old))
+        return false;  // came from a pool or malloc()
+
+    if (cast(REBU64, capacity) * wide > INT32_MAX)
+        return false;  // Did_Series_Data_Alloc() has the same limit
+
+    size_t size_old = Round_Large_Size(total_old);
+    size_t size = Round_Large_Size(capacity * wide);
+    assert(size > size_old);
+
+    void *p = mremap(s->content.dynamic.data, size_old, size, MREMAP_MAYMOVE);
+    if (p == MAP_FAILED)
+        return false;  // caller can still try a new allocation and copying
+
+    Advise_Huge_Pages(p, size);
+
+    PG_Mem_Usage += size - size_old;
+    Mem_Pools[SYSTEM_POOL].has += size - size_old;
+    if ((GC_Ballast -= size - size_old) <= 0)
+        SET_SIGNAL(SIG_RECYCLE);
+
+    REBLEN rest_old = s->content.dynamic.rest;
+    s->content.dynamic.data = cast(char*, p);
+    s->content.dynamic.rest = size / wide;
+
+    if (IS_SER_ARRAY(s)) {  // prep the new capacity, as Prep_Array() would
+        RELVAL *prep = ARR_AT(ARR(s), rest_old);
+        REBLEN n;
+        for (n = rest_old; n < s->content.dynamic.rest; ++n, ++prep)
+            Prep_Cell(prep);
+
+      #ifdef DEBUG_TERM_ARRAYS
+        Init_Trash(ARR_AT(ARR(s), s->content.dynamic.rest - 1));
+      #endif
+    }
+
+    return true;
+}
+
+#endif
+
+
 //
 //  Expand_Series: C
 //
@@ -846,6 +1445,24 @@ void Expand_Series(REBSER *s, REBLEN index, REBLEN delta)
     }
   #endif
 
+  #if defined(HAS_MREMAP)
+    if (
+        was_dynamic
+        and SER_BIAS(s) == 0
+        and Try_Grow_Large_Series(s, used_old + delta + x)
+    ){
+        if (n_found >= MAX_EXPAND_LIST)
+            Prior_Expand[n_available] = s;
+
+      #if defined(DEBUG_COLLECT_STATS)
+        PG_Reb_Stats->Series_Expanded++;
+      #endif
+
+        Expand_Series(s, index, delta);  // now fits, so only slides data
+        return;
+    }
+  #endif
+
     // !!! The protocol for doing new allocations currently mandates that the
     // dynamic content area be cleared out.  But the data lives in the content
     // area if there's no dynamic portion.  The in-REBSER content has to be
@@ -909,7 +1526,7 @@ void Expand_Series(REBSER *s, REBLEN index, REBLEN delta)
     PG_Reb_Stats->Series_Expanded++;
   #endif
 
-    assert(NOT_SERIES_FLAG(s, MARKED));
+    assert(GC_Sweep_Pending or NOT_SERIES_FLAG(s, MARKED));
 }
 
 
@@ -26,6 +26,57 @@
 
 #include "sys-core.h"
 
+#if defined(RESERVED_DATA_STACK)
+    #include <sys/mman.h>  // for mmap(), mprotect()
+#endif
+
+
+#if defined(RESERVED_DATA_STACK)
+
+// The data stack's cells live in a mapping big enough for STACK_LIMIT cells,
+// which is reserved (PROT_NONE) at startup.  Pages are made accessible as the
+// stack grows, so the cells never move and growing never copies.
+//
+static size_t Data_Stack_Reserve_Size(void)
+  { return Round_Large_Size(STACK_LIMIT * sizeof(RELVAL)); }
+
+
+// Make at least `rest` cells of the reserved space usable, plus one more for
+// the terminator that DEBUG_TERM_ARRAYS builds write past the tail.  Whole
+// pages are committed, so the series rest may come out bigger than asked.
+//
+static bool Try_Commit_Data_Stack(REBLEN rest)
+{
+    REBSER *s = DS_Array;
+    REBLEN rest_old = SER_REST(s);
+    size_t size_old = Round_Large_Size(rest_old * sizeof(RELVAL));
+    size_t size = Round_Large_Size((rest + 1) * sizeof(RELVAL));
+    if (size <= size_old)
+        return true;
+
+    assert(size <= Data_Stack_Reserve_Size());
+    if (0 != mprotect(
+        s->content.dynamic.data + size_old,
+        size - size_old,
+        PROT_READ | PROT_WRITE
+    )){
+        return false;
+    }
+
+    PG_Mem_Usage += size - size_old;
+
+    s->content.dynamic.rest = size / sizeof(RELVAL);
+
+    RELVAL *prep = ARR_AT(ARR(s), rest_old);  // as Prep_Array() would
+    REBLEN n;
+    for (n = rest_old; n < s->content.dynamic.rest; ++n, ++prep)
+        Prep_Cell(prep);
+
+    return true;
+}
+
+#endif
+
 
 //
 //  Startup_Data_Stack: C
@@ -38,7 +89,33 @@ void Startup_Data_Stack(REBLEN capacity)
     // that indices into the data stack can be unsigned (no need for -1 to
     // mean empty, because 0 can)
     //
+  #if defined(RESERVED_DATA_STACK)
+    DS_Array = Make_Array_Core(1, FLAG_FLAVOR(DATASTACK) | SERIES_FLAG_DYNAMIC);
+    Free_Unbiased_Series_Data(
+        DS_Array->content.dynamic.data,
+        SER_TOTAL(DS_Array)
+    );
+
+    void *reserved = mmap(
+        nullptr,
+        Data_Stack_Reserve_Size(),
+        PROT_NONE,
+        MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE,
+        -1,
+        0
+    );
+    if (reserved == MAP_FAILED)
+        panic ("Could not reserve address space for the data stack");
+
+    DS_Array->content.dynamic.data = cast(char*, reserved);
+    DS_Array->content.dynamic.rest = 0;
+    DS_Array->content.dynamic.used = 0;
+    if (not Try_Commit_Data_Stack(1))
+        panic ("Could not commit memory for the data stack");
+  #else
     DS_Array = Make_Array_Core(1, FLAG_FLAVOR(DATASTACK) | SERIES_FLAGS_NONE);
+  #endif
+
     Init_Trash(ARR_HEAD(DS_Array));
     SET_CELL_FLAG(ARR_HEAD(DS_Array), PROTECTED);
 
@@ -68,6 +145,15 @@ void Shutdown_Data_Stack(void)
     assert(DSP == 0);
     assert(IS_TRASH(ARR_HEAD(DS_Array)));
 
+  #if defined(RESERVED_DATA_STACK)
+    PG_Mem_Usage -= Round_Large_Size(SER_REST(DS_Array) * sizeof(RELVAL));
+    munmap(DS_Array->content.dynamic.data, Data_Stack_Reserve_Size());
+
+    // The data is gone, so GC_Kill_Series() must not try to free it.
+    //
+    SET_SERIES_FLAG(DS_Array, INACCESSIBLE);
+  #endif
+
     Free_Unmanaged_Series(DS_Array);
 }
 
@@ -250,6 +336,10 @@ REBCTX *Get_Context_From_Stack(void)
 // which could do a push or pop.  (Currently stable w.r.t. pop but there may
 // be compaction at some point.)
 //
+// (RESERVED_DATA_STACK builds never move the cells, and growing just makes
+// more of the reserved pages accessible.  But code must still not count on
+// pointers surviving a push, since other builds move the stack.)
+//
 void Expand_Data_Stack_May_Fail(REBLEN amount)
 {
     REBLEN len_old = ARR_LEN(DS_Array);
@@ -276,7 +366,14 @@ void Expand_Data_Stack_May_Fail(REBLEN amount)
         Fail_Stack_Overflow(); // !!! Should this be a "data stack" message?
     }
 
+  #if defined(RESERVED_DATA_STACK)
+    if (not Try_Commit_Data_Stack(len_old + amount)) {
+        --DS_Index;  // see above
+        fail (Error_No_Memory(amount * sizeof(RELVAL)));
+    }
+  #else
     Extend_Series(DS_Array, amount);
+  #endif
 
     // Update the pointer used for fast access to the top of the stack that
     // likely was moved by the above allocation (needed before using DS_TOP)
@@ -320,6 +320,8 @@ bool Do_Frame_Maybe_Stale_Throws(REBVAL *out, REBVAL *frame) {
 //      /args "Sets system/script/args if doing a script (usually a TEXT!)"
 //          [any-value!]
 //      /only "Don't catch QUIT (default behavior for BLOCK!)"
+//      /budget "Fail with BUDGET-EXHAUSTED if evaluation goes over the limit"
+//          [integer! time!]  "Evaluator steps, or CPU time (arrays only)"
 //  ]
 //
 REBNATIVE(do)
@@ -329,6 +331,42 @@ REBNATIVE(do)
 
     REBVAL *source = ARG(source);
 
+    // The budget is checked in Do_Signals_Throws(), so nothing about running
+    // the array changes.  It's only in effect while the array runs.  (If the
+    // budget runs out, the trap that catches the failure restores the budget
+    // that was there before, see Snap_State_Core().)
+    //
+    if (REF(budget)) {
+        if (not ANY_ARRAY(source))
+            fail ("DO/BUDGET only runs BLOCK! and GROUP! source");
+
+        REBI64 ticks = 0;
+        REBI64 usec = 0;
+        if (IS_INTEGER(ARG(budget)))
+            ticks = VAL_INT64(ARG(budget));
+        else
+            usec = VAL_NANO(ARG(budget)) / 1000;
+
+        if (ticks <= 0 and usec <= 0)
+            fail (PAR(budget));
+
+        if (NOT_CELL_FLAG(source, CONST))
+            SET_CELL_FLAG(source, EXPLICITLY_MUTABLE);  // as below
+
+        REBI64 saved_budget_tick = Eval_Budget_Tick;
+        REBI64 saved_budget_usec = Eval_Budget_Usec;
+        Tighten_Eval_Budget(ticks, usec);
+
+        bool threw = Do_Any_Array_At_Throws(D_OUT, source, SPECIFIED);
+
+        Eval_Budget_Tick = saved_budget_tick;
+        Eval_Budget_Usec = saved_budget_usec;
+
+        if (threw)
+            return R_THROWN;
+        return D_OUT;
+    }
+
     // Due to the mechanics of true invisibility, `1 + 2 do [comment "hi"]`
     // cannot rely on OUT_NOTE_STALE...because it clears the stale flag.  This
     // may be a bug or bad mechanic overall, but getting the right information
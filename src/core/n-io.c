@@ -56,13 +56,23 @@ REBNATIVE(form)
 }
 
 
+//
+// Flush hook for MOLD/INTO.  WRITE might mold (and move the mold buffer), so
+// the bytes are copied out before it runs.
+//
+static void Flush_Mold_To_Port(REB_MOLD *mo, const REBYTE *utf8, REBSIZ size)
+{
+    rebElide("write", mo->sink, rebR(rebSizedBinary(utf8, size)));
+}
+
+
 //
 //  mold: native [
 //
 //  "Converts a value to a REBOL-readable string."
 //
-//      return: "NULL if input is NULL"
-//          [<opt> text!]
+//      return: "NULL if input is NULL, the port if /INTO"
+//          [<opt> text! port!]
 //      truncated: "<output> Whether the mold was truncated"
 //          [logic!]
 //
@@ -73,6 +83,8 @@ REBNATIVE(form)
 //      /flat "No indentation"
 //      /limit "Limit to a certain length"
 //          [integer!]
+//      /into "Write to a port a chunk at a time, instead of making a string"
+//          [port!]
 //  ]
 //
 REBNATIVE(mold)
@@ -93,6 +105,14 @@ REBNATIVE(mold)
         SET_MOLD_FLAG(mo, MOLD_FLAG_LIMIT);
         mo->limit = Int32(ARG(limit));
     }
+    if (REF(into)) {
+        if (REF(limit))
+            fail (Error_Bad_Refines_Raw());
+
+        SET_MOLD_FLAG(mo, MOLD_FLAG_STREAM);
+        mo->flush = &Flush_Mold_To_Port;
+        mo->sink = ARG(into);
+    }
 
     Push_Mold(mo);
 
@@ -101,7 +121,14 @@ REBNATIVE(mold)
 
     Mold_Value(mo, v);
 
-    REBSTR *popped = Pop_Molded_String(mo);  // sets MOLD_FLAG_TRUNCATED
+    REBSTR *popped;
+    if (REF(into)) {  // whatever wasn't flushed during the mold goes now
+        Flush_Mold(mo);
+        Drop_Mold(mo);
+        popped = nullptr;
+    }
+    else
+        popped = Pop_Molded_String(mo);  // sets MOLD_FLAG_TRUNCATED
 
     if (REF(truncated))
         rebElide(
@@ -110,6 +137,9 @@ REBNATIVE(mold)
             rebL(mo->opts & MOLD_FLAG_WAS_TRUNCATED)
         );
 
+    if (REF(into))
+        RETURN (ARG(into));
+
     return Init_Text(D_OUT, popped);
 }
 
@@ -105,6 +105,9 @@ REBNATIVE(exit_rebol)
 //      /ballast "Trigger for auto-recycle (memory used)"
 //          [integer!]
 //      /torture "Constant recycle (for internal debugging)"
+//      /lazy "Make automatic recycles leave sweeping for between evaluations"
+//          [logic!]
+//      /trim "Give memory that isn't in use back to the operating system"
 //      /watch "Monitor recycling (debug only)"
 //      /verbose "Dump information about series being recycled (debug only)"
 //  ]
@@ -133,6 +136,9 @@ REBNATIVE(recycle)
         TG_Ballast = 0;
     }
 
+    if (REF(lazy))  // RECYCLE itself still sweeps (and finishes a lazy sweep)
+        GC_Lazy_Sweep = VAL_LOGIC(ARG(lazy));
+
     if (GC_Disabled)
         return nullptr; // don't give misleading "0", since no recycle ran
 
@@ -163,6 +169,11 @@ REBNATIVE(recycle)
         count = Recycle();
     }
 
+    if (REF(trim)) {
+        Trim_Pools(true);
+        Trim_Series_Data();
+    }
+
     if (REF(watch)) {
       #if defined(NDEBUG)
         fail (Error_Debug_Only_Raw());
@@ -31,26 +31,18 @@ const z_crc_t *crc32_table; // pointer to the zlib CRC32 table
 
 
 //
-//  Hash_UTF8: C
-//
-// Return a case-insensitive hash value for UTF-8 data that has not previously
-// been validated, with the size in bytes.
+//  Hash_UTF8_Caseless: C
 //
-// See also: Hash_UTF8_Caseless(), which works with already validated UTF-8
-// bytes and takes a length in codepoints instead of a byte size.
+// Return a 32-bit case insensitive hash value for known valid UTF-8 data.
+// Length is in characters, not bytes.
 //
-uint32_t Hash_Scan_UTF8_Caseless_May_Fail(const REBYTE *utf8, REBSIZ size)
-{
+uint32_t Hash_UTF8_Caseless(REBCHR(const*) cp, REBLEN len) {
     uint32_t crc = 0x00000000;
 
-    for (; size != 0; ++utf8, --size) {
-        REBUNI c = *utf8;
-
-        if (c >= 0x80) {
-            utf8 = Back_Scan_UTF8_Char(&c, utf8, &size);
-            if (utf8 == nullptr)
-                fail (Error_Bad_Utf8_Raw());
-        }
+    REBLEN n;
+    for (n = 0; n < len; n++) {
+        REBUNI c;
+        cp = NEXT_CHR(&c, cp);
 
         c = LO_CASE(c);
 
@@ -68,36 +60,91 @@ uint32_t Hash_Scan_UTF8_Caseless_May_Fail(const REBYTE *utf8, REBSIZ size)
 }
 
 
+// The spelling hash works on 8 bytes of lowercased UTF-8 at a time.  For
+// ASCII, the bytes can be lowercased all at once in a 64-bit register
+// ("SIMD within a register"): each byte gets its high bit set if it is at
+// least 'A', another if it is over 'Z', and where only the first is set the
+// 0x20 bit is added.  (Bytes are under 0x80, so none of the adds carry.)
 //
-//  Hash_UTF8_Caseless: C
+#define SPELLING_ONES cast(uint64_t, 0x0101010101010101)
+#define SPELLING_MIX cast(uint64_t, 0x9E3779B97F4A7C15)
+
+inline static uint64_t Lowercase_Ascii_Chunk(uint64_t chunk) {
+    uint64_t at_least_A = chunk + SPELLING_ONES * (0x80 - 'A');
+    uint64_t over_Z = chunk + SPELLING_ONES * (0x80 - 'Z' - 1);
+    uint64_t upper = at_least_A & ~over_Z & (SPELLING_ONES * 0x80);
+    return chunk | (upper >> 2);
+}
+
+inline static uint64_t Mix_Spelling_Chunk(uint64_t hash, uint64_t chunk) {
+    hash = (hash ^ chunk) * SPELLING_MIX;
+    return hash ^ (hash >> 29);
+}
+
+
 //
-// Return a 32-bit case insensitive hash value for known valid UTF-8 data.
-// Length is in characters, not bytes.
+//  Hash_Spelling_May_Fail: C
 //
-// See also: Hash_Scan_UTF8_Caseless_May_Fail(), which takes unverified
-// UTF8 and a byte count instead.
+// Case-insensitive hash of unverified UTF-8 for the symbol table, where the
+// hash of each symbol is stored next to it (see Intern_UTF8_Managed()).  It
+// only has to agree with itself, so it's not the same as Hash_UTF8_Caseless()
+// that's used e.g. on MAP! keys.
 //
-uint32_t Hash_UTF8_Caseless(REBCHR(const*) cp, REBLEN len) {
-    uint32_t crc = 0x00000000;
+// Spellings are almost always ASCII, which is taken 8 bytes at a time.  The
+// general case feeds the same 8-byte chunks, made of the UTF-8 encoding of
+// each lowercased codepoint, so synonyms hash the same whatever the path.
+//
+uint32_t Hash_Spelling_May_Fail(const REBYTE *utf8, REBSIZ size)
+{
+    uint64_t hash = 0;
+    uint64_t chunk;
+    REBSIZ fed = 0;  // lowercasing can change the size (e.g. KELVIN SIGN)
+
+    for (; size >= 8; utf8 += 8, size -= 8, fed += 8) {
+        memcpy(&chunk, utf8, 8);
+        if (chunk & (SPELLING_ONES * 0x80))
+            break;  // not all ASCII, finish up the slow way
+        hash = Mix_Spelling_Chunk(hash, Lowercase_Ascii_Chunk(chunk));
+    }
 
-    REBLEN n;
-    for (n = 0; n < len; n++) {
-        REBUNI c;
-        cp = NEXT_CHR(&c, cp);
+    REBYTE buf[8 + UNI_ENCODED_MAX];
+    REBLEN n = 0;
+    for (; size != 0; ++utf8, --size) {
+        REBUNI c = *utf8;
+
+        if (c >= 0x80) {
+            utf8 = Back_Scan_UTF8_Char(&c, utf8, &size);
+            if (utf8 == nullptr)
+                fail (Error_Bad_Utf8_Raw());
+        }
 
         c = LO_CASE(c);
+        if (c < 0x80)
+            buf[n++] = cast(REBYTE, c);
+        else {
+            uint_fast8_t encoded_size = Encoded_Size_For_Codepoint(c);
+            Encode_UTF8_Char(buf + n, c, encoded_size);
+            n += encoded_size;
+        }
 
-        // !!! This takes into account all 4 bytes of the lowercase codepoint
-        // for the CRC calculation.  In ASCII strings this will involve a lot
-        // of zeros.  Review if there's a better way.
-        //
-        crc = (crc >> 8) ^ crc32_table[(crc ^ c) & 0xff];
-        crc = (crc >> 8) ^ crc32_table[(crc ^ (c >> 8)) & 0xff];
-        crc = (crc >> 8) ^ crc32_table[(crc ^ (c >> 16)) & 0xff];
-        crc = (crc >> 8) ^ crc32_table[(crc ^ (c >> 24)) & 0xff];
+        if (n >= 8) {
+            memcpy(&chunk, buf, 8);
+            hash = Mix_Spelling_Chunk(hash, chunk);
+            memmove(buf, buf + 8, n - 8);
+            n -= 8;
+            fed += 8;
+        }
     }
 
-    return ~crc;
+    if (n != 0) {
+        memset(buf + n, 0, 8 - n);
+        memcpy(&chunk, buf, 8);
+        hash = Mix_Spelling_Chunk(hash, chunk);
+        fed += n;
+    }
+
+    hash = Mix_Spelling_Chunk(hash, fed);
+    return cast(uint32_t, hash ^ (hash >> 32));
 }
 
 
@@ -163,7 +163,7 @@ void New_Indented_Line(REB_MOLD *mo)
     // Check output string has content already but no terminator:
     //
     REBYTE *bp;
-    if (STR_LEN(mo->series) == 0)
+    if (STR_SIZE(mo->series) == mo->offset)  // don't touch an outer mold's
         bp = nullptr;
     else {
         bp = BIN_LAST(mo->series);  // legal way to check UTF-8
@@ -291,6 +291,13 @@ void Mold_Array_At(
         if (item == item_tail)
             break;
 
+        // Between items is a good place to flush a streaming mold.  (Code
+        // that looks back at what's already molded only looks at the last
+        // character, which a flush keeps, see Flush_Mold_Core().)
+        //
+        if (GET_MOLD_FLAG(mo, MOLD_FLAG_STREAM))
+            Throttle_Mold(mo);
+
         if (NOT_CELL_FLAG(item, NEWLINE_BEFORE))
             Append_Codepoint(mo->series, ' ');
     }
@@ -679,12 +686,67 @@ void Push_Mold(REB_MOLD *mo)
 }
 
 
+//
+//  Flush_Mold_Core: C
+//
+// Hand what a streaming mold has accumulated to its flush hook, then reset
+// the buffer back to where the mold started.  The mold stays pushed, so this
+// can be done as many times as needed before the final Drop_Mold().
+//
+// Mold code may look at the last character of the buffer (e.g. MF_Comma()
+// turning a trailing space into a comma), so flushes in the middle of a mold
+// keep the last character back.  See Flush_Mold() for the final flush.
+//
+void Flush_Mold_Core(REB_MOLD *mo, bool keep_last)
+{
+    assert(GET_MOLD_FLAG(mo, MOLD_FLAG_STREAM));
+    ASSERT_SERIES_TERM_IF_NEEDED(mo->series);
+
+    REBSIZ size = STR_SIZE(mo->series) - mo->offset;
+    if (size == 0)
+        return;
+
+    REBSIZ keep = 0;  // bytes in the last character, if keeping it
+    if (keep_last) {
+        const REBYTE *head = BIN_AT(mo->series, mo->offset);
+        do {
+            ++keep;
+        } while (keep < size and (head[size - keep] & 0xC0) == 0x80);
+
+        if (keep == size)
+            return;  // nothing before it to flush
+    }
+
+    mo->flush(mo, BIN_AT(mo->series, mo->offset), size - keep);
+
+    // The hook may have molded, which can move the buffer's data.
+    //
+    memmove(
+        BIN_AT(mo->series, mo->offset),
+        BIN_AT(mo->series, mo->offset + size - keep),
+        keep
+    );
+    TERM_STR_LEN_SIZE(
+        mo->series,
+        mo->index + (keep == 0 ? 0 : 1),
+        mo->offset + keep
+    );
+}
+
+
 //
 //  Throttle_Mold: C
 //
-// Contain a mold's series to its limit (if it has one).
+// Contain a mold's series to its limit (if it has one).  A streaming mold is
+// flushed instead, once it has accumulated MOLD_STREAM_SIZE bytes.
 //
 void Throttle_Mold(REB_MOLD *mo) {
+    if (GET_MOLD_FLAG(mo, MOLD_FLAG_STREAM)) {
+        if (STR_SIZE(mo->series) - mo->offset >= MOLD_STREAM_SIZE)
+            Flush_Mold_Core(mo, true);
+        return;
+    }
+
     if (NOT_MOLD_FLAG(mo, MOLD_FLAG_LIMIT))
         return;
 
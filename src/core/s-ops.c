@@ -127,7 +127,7 @@ void Trim_Tail(REB_MOLD *mo, REBYTE ascii)
     REBLEN len = STR_LEN(mo->series);
     REBSIZ size = STR_SIZE(mo->series);
 
-    for (; size > 0; --size, --len) {
+    for (; size > mo->offset; --size, --len) {  // only trim this mold
         REBYTE b = *BIN_AT(mo->series, size - 1);
         if (b != ascii)
             break;
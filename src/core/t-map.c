@@ -243,6 +243,20 @@ void Expand_Hash(REBSER *ser)
 }
 
 
+// Set the value of the n'th pair (1-based) in a map.  Both Find_Map_Entry()
+// and the cached path in PD_Map() write values here.
+//
+static void Set_Map_Pair_Value(
+    REBARR *pairlist,
+    REBLEN n,
+    const RELVAL *val,
+    REBSPC *val_specifier
+){
+    assert(n != 0 and n <= ARR_LEN(pairlist) / 2);
+    Derelativize(ARR_AT(pairlist, ((n - 1) * 2) + 1), val, val_specifier);
+}
+
+
 //
 //  Find_Map_Entry: C
 //
@@ -295,11 +309,7 @@ REBLEN Find_Map_Entry(
 
     // Must set the value:
     if (n) {  // re-set it:
-        Derelativize(
-            ARR_AT(pairlist, ((n - 1) * 2) + 1),
-            val,
-            val_specifier
-        );
+        Set_Map_Pair_Value(pairlist, n, val, val_specifier);
         return n;
     }
 
@@ -337,10 +347,44 @@ REB_R PD_Map(
     //
     const bool cased = false;
 
+    // A WORD! picker remembers which pair it was found in for this map's
+    // pairlist, to skip the hashing next time.  Pairs aren't moved or taken
+    // out of the pairlist (removal leaves a "zombie" with a null value), so
+    // the pair is still right as long as it still has the word as its key.
+    //
+    // (If a map has keys that only differ in case, e.g. from PUT, then which
+    // one a path gets is arbitrary anyway.)
+    //
+    REB_PICK_CACHE *cache = nullptr;
+    REBLEN n = 0;
+    if (IS_WORD(picker)) {
+        const REBARR *pairlist = MAP_PAIRLIST(VAL_MAP(pvs->out));
+        cache = Pick_Cache_For(picker);
+        if (
+            cache->picker == picker
+            and cache->shape == pairlist
+            and cache->index != 0
+            and cache->index <= ARR_LEN(pairlist) / 2
+        ){
+            const RELVAL *key = ARR_AT(pairlist, (cache->index - 1) * 2);
+            if (IS_WORD(key) and Are_Synonyms(
+                VAL_WORD_SYMBOL(key),
+                VAL_WORD_SYMBOL(picker)
+            )){
+                n = cache->index;
+            }
+        }
+    }
+
     if (setval) {
         REBMAP *m = VAL_MAP_ENSURE_MUTABLE(pvs->out);
 
-        REBINT n = Find_Map_Entry(
+        if (n != 0) {  // cached pair, re-set it like Find_Map_Entry() would
+            Set_Map_Pair_Value(MAP_PAIRLIST(m), n, unwrap(setval), SPECIFIED);
+            return R_INVISIBLE;
+        }
+
+        n = Find_Map_Entry(
             m,  // modified (if not located in map)
             picker,
             SPECIFIED,
@@ -349,24 +393,35 @@ REB_R PD_Map(
             cased
         );
 
-        assert(n != 0);
-        UNUSED(n);
+        if (cache and n != 0) {  // n is 0 if NULL was set for a missing key
+            cache->picker = picker;
+            cache->shape = MAP_PAIRLIST(m);
+            cache->index = n;
+        }
         return R_INVISIBLE;
     }
 
     const REBMAP *m = VAL_MAP(pvs->out);
 
-    REBINT n = Find_Map_Entry(
-        m_cast(REBMAP*, m),  // not modified
-        picker,
-        SPECIFIED,
-        nullptr,  // no value, so map not changed
-        SPECIFIED,
-        cased
-    );
+    if (n == 0) {
+        n = Find_Map_Entry(
+            m_cast(REBMAP*, m),  // not modified
+            picker,
+            SPECIFIED,
+            nullptr,  // no value, so map not changed
+            SPECIFIED,
+            cased
+        );
 
-    if (n == 0)
-        return nullptr;
+        if (n == 0)
+            return nullptr;
+
+        if (cache) {
+            cache->picker = picker;
+            cache->shape = MAP_PAIRLIST(m);
+            cache->index = n;
+        }
+    }
 
     const REBVAL *val = SPECIFIC(
         ARR_AT(MAP_PAIRLIST(m), ((n - 1) * 2) + 1)
@@ -405,16 +405,42 @@ REB_R PD_Context(
     // See if the binding of the word is already to the context (so there's
     // no need to go hunting).  'x
     //
+    // Records made from the same prototype share a keylist, so a path like
+    // `item/name` run on each of them finds `name` at the same index.  That
+    // index is remembered for the picker cell along with the keylist it was
+    // found in, to use when the keylist is the same (the binding cache below
+    // only helps when it's the same object).  FRAME! is left out, since what
+    // its keys mean depends on the phase.
+    //
+    REB_PICK_CACHE *cache = Pick_Cache_For(picker);
+    const REBSYM *symbol = VAL_WORD_SYMBOL(picker);
+
     REBLEN n;
     if (BINDING(picker) == c)
         n = VAL_WORD_INDEX(picker);
+    else if (
+        cache->picker == picker
+        and cache->shape == CTX_KEYLIST(c)
+        and cache->index <= CTX_LEN(c)
+        and Are_Synonyms(KEY_SYMBOL(CTX_KEY(c, cache->index)), symbol)
+        and not IS_FRAME(pvs->out)
+        and not Is_Param_Hidden(cast_PAR(CTX_VAR(c, cache->index)))
+    ){
+        n = cache->index;
+    }
     else {
         const bool strict = false;
-        n = Find_Symbol_In_Context(pvs->out, VAL_WORD_SYMBOL(picker), strict);
+        n = Find_Symbol_In_Context(pvs->out, symbol, strict);
 
         if (n == 0)
             return R_UNHANDLED;
 
+        if (not IS_FRAME(pvs->out)) {
+            cache->picker = picker;
+            cache->shape = CTX_KEYLIST(c);
+            cache->index = n;
+        }
+
         // !!! As an experiment, try caching the binding index in the word.
         // This "corrupts" it, but if we say paths effectively own their
         // top-level words that could be all right.  Note this won't help if
@@ -579,6 +605,7 @@ REBCTX *Copy_Context_Extra_Managed(
         );
 
         mutable_LINK(Ancestor, keylist) = CTX_KEYLIST(original);
+        mutable_MISC(KeyHash, keylist) = nullptr;
 
         INIT_CTX_KEYLIST_UNIQUE(copy, keylist);  // ->link field
     }
@@ -119,6 +119,19 @@
 #define BONUS_Patches_CAST      ARR
 #define HAS_BONUS_Patches       FLAVOR_VARLIST
 
+// Keylists with more than KEYLIST_HASH_THRESHOLD keys get a side index when
+// Find_Symbol_In_Context() is first used on them, so it doesn't have to scan
+// all the keys.  It's a HASHLIST of key indices (0 for an unused slot) that
+// lives in the keylist's MISC(), so contexts sharing a keylist share it too.
+// It is nullptr until built, and gets dropped instead of being expanded when
+// Append_Context() would make it over half full.
+//
+#define MISC_KeyHash_TYPE       REBSER*
+#define MISC_KeyHash_CAST       SER
+#define HAS_MISC_KeyHash        FLAVOR_KEYLIST
+
+#define KEYLIST_HASH_THRESHOLD  16
+
 
 // ANY-CONTEXT! value cell schematic
 //
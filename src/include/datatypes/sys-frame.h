@@ -225,6 +225,7 @@ inline static option(const REBSTR*) FRM_LABEL(REBFRM *f) {
 inline static REBCTX *Context_For_Frame_May_Manage(REBFRM *f) {
     assert(not Is_Action_Frame_Fulfilling(f));
     SET_SERIES_FLAG(f->varlist, MANAGED);
+    Keep_From_Lazy_Sweep(f->varlist);
     return CTX(f->varlist);
 }
 
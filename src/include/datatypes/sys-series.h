@@ -727,6 +727,7 @@ inline static REBSER *Manage_Series(REBSER *s)  // give manual series to GC
   #endif
 
     s->leader.bits |= NODE_FLAG_MANAGED;
+    Keep_From_Lazy_Sweep(s);
     Untrack_Manual_Series(s);
     return s;
 }
@@ -1157,6 +1158,22 @@ inline static REBLEN FIND_POOL(size_t size) {
 }
 
 
+#if defined(MMAP_LARGE_SERIES)
+    //
+    // Allocations of SYSTEM_POOL size that are this big are rounded up to
+    // whole pages and mmap()'d (see Try_Alloc_Large()).  The freeing code
+    // only knows SER_TOTAL(), which can be less than the allocation by less
+    // than the series width...so decisions are made on the rounded size.
+    //
+    inline static size_t Round_Large_Size(size_t size) {
+        return (size + PG_Page_Size - 1) & ~cast(size_t, PG_Page_Size - 1);
+    }
+
+    inline static bool Is_Large_Size(size_t size)
+      { return Round_Large_Size(size) >= MEM_LARGE_SIZE; }
+#endif
+
+
 // Allocates element array for an already allocated REBSER node structure.
 // Resets the bias and tail to zero, and sets the new width.  Flags like
 // SERIES_FLAG_FIXED_SIZE are left as they were, and other fields in the
@@ -1216,7 +1233,15 @@ inline static bool Did_Series_Data_Alloc(REBSER *s, REBLEN capacity) {
                 CLEAR_SERIES_FLAG(s, POWER_OF_2);
         }
 
-        s->content.dynamic.data = TRY_ALLOC_N(char, size);
+      #if defined(MMAP_LARGE_SERIES)
+        if (Is_Large_Size(size)) {
+            size = Round_Large_Size(size);
+            s->content.dynamic.data = cast(char*, Try_Alloc_Large(size));
+        }
+        else
+      #endif
+            s->content.dynamic.data = TRY_ALLOC_N(char, size);
+
         if (not s->content.dynamic.data)
             return false;
 
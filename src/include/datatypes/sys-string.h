@@ -830,17 +830,6 @@ inline static REBSTR *Make_Sized_String_UTF8(const char *utf8, size_t size) {
 inline static REBINT Hash_String(const REBSTR *str)
     { return Hash_UTF8_Caseless(STR_HEAD(str), STR_LEN(str)); }
 
-inline static REBINT First_Hash_Candidate_Slot(
-    REBLEN *skip_out,
-    REBLEN hash,
-    REBLEN num_slots
-){
-    *skip_out = (hash & 0x0000FFFF) % num_slots;
-    if (*skip_out == 0)
-        *skip_out = 1;
-    return (hash & 0x00FFFF00) % num_slots;
-}
-
 
 //=//// REBSTR COPY HELPERS ///////////////////////////////////////////////=//
 
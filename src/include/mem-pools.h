@@ -65,6 +65,8 @@ struct rebol_mem_pool {
 
 #define MEM_MIN_SIZE sizeof(REBVAL)
 #define MEM_BIG_SIZE 1024
+#define MEM_LARGE_SIZE (256 * 1024)  // see MMAP_LARGE_SERIES
+#define MEM_HUGE_PAGE_SIZE (2 * 1024 * 1024)  // transparent huge page size
 
 #define MEM_BALLAST 3000000
 
@@ -123,3 +125,29 @@ struct Reb_Pool_Unit {
     //
     /* REBI64 payload[N];*/
 };
+
+
+//=//// PER-THREAD MAGAZINES //////////////////////////////////////////////=//
+//
+// With NODE_MAGAZINES, each thread keeps a small stack of free units for each
+// pool.  Alloc_Node() and Free_Node() only go to the pool's free list (and
+// take the lock for it) when the magazine is empty or full, and then they
+// move half a magazine's worth of units at a time.
+//
+// Units in a magazine have FREED_SERIES_BYTE like any free unit, but are not
+// on the pool's free list or counted in its `free`.
+//
+// Only the thread running the interpreter may recycle, and other threads
+// must not be allocating while it does.  A thread has to Flush_Magazines()
+// before it exits, or the units it was holding are lost.
+//
+#if defined(NODE_MAGAZINES)
+    #define MAGAZINE_SIZE 64
+
+    typedef struct rebol_mem_magazine {
+        REBLEN count;
+        REBPLU *units[MAGAZINE_SIZE];
+    } REBMAG;
+
+    extern __thread REBMAG TG_Magazines[SYSTEM_POOL];
+#endif
@@ -442,6 +442,103 @@ Special internal defines used by RT, not Host-Kit developers:
 #endif
 
 
+// DEBUG_CHECK_LAZY_SWEEP runs the marking phase again before each segment of
+// a lazy sweep (RECYCLE/LAZY), and panics if a node that can be reached has
+// no mark in a segment the sweep hasn't gotten to.  That finds places which
+// need Keep_From_Lazy_Sweep(), but makes lazy sweeping very slow.
+//
+#ifdef DEBUG_CHECK_LAZY_SWEEP
+    #if defined(NDEBUG)
+        #error "DEBUG_CHECK_LAZY_SWEEP requires a debug build"
+    #endif
+#endif
+
+
+// NODE_MAGAZINES puts a per-thread cache of free units (a "magazine") in front
+// of each memory pool, so Alloc_Node() and Free_Node() only have to lock the
+// pools to move units in batches.  Nothing but NODE-ALLOC-BENCHMARK allocates
+// from other threads yet, so this is an opt-in switch for builds that link
+// with POSIX threads (e.g. -pthread).
+//
+// Magazines hand out the most recently freed unit first, which would undo the
+// debug build's delayed reuse of freed units (that keeps stale pointers to
+// them poisoned longer).  So it's only for release builds.
+//
+#ifdef NODE_MAGAZINES
+    #if defined(TO_WINDOWS)
+        #error "NODE_MAGAZINES is currently only written for POSIX threads"
+    #endif
+    #if !defined(NDEBUG)
+        #error "NODE_MAGAZINES is only for release builds, see reb-config.h"
+    #endif
+#endif
+
+
+// Series data of MEM_LARGE_SIZE or more gets its own mmap() on POSIX systems,
+// so it goes back to the OS as soon as it is freed.  On Linux, mremap() also
+// lets Expand_Series() grow it without copying.  The R3_HUGE_PAGES variable
+// asks for transparent huge pages for the biggest ones.  Build with
+// NO_MMAP_LARGE_SERIES to use malloc() for all series data as before.
+//
+#if !defined(TO_WINDOWS) && !defined(TO_AMIGA) \
+        && !defined(NO_MMAP_LARGE_SERIES)
+    #define MMAP_LARGE_SERIES
+
+    #if defined(TO_LINUX) || defined(TO_ANDROID)
+        #define HAS_MREMAP
+    #endif
+#endif
+
+
+// Where large series are mmap()'d, the data stack reserves address space for
+// its full STACK_LIMIT at startup and makes pages accessible as it grows.  So
+// a push that runs out of room never has to copy the stack.  Build with
+// NO_RESERVED_DATA_STACK to keep it an array expanded by Extend_Series().
+//
+#if defined(MMAP_LARGE_SERIES) && !defined(NO_RESERVED_DATA_STACK)
+    #define RESERVED_DATA_STACK
+#endif
+
+
+// The scanner steps over runs of spaces, word characters, comments and plain
+// string content 16 bytes at a time with SSE2, which every x86-64 target
+// has.  (AVX2 would need checking the CPU at runtime, as builds aren't made
+// for a particular processor.)  Build with NO_SCAN_SSE2 to only use the
+// byte-at-a-time loops.
+//
+// The 16-byte loads are aligned, and only of blocks that end at or before
+// the scanned string's '\0' terminator, so nothing outside the buffer is
+// read (Address Sanitizer and Valgrind builds can use them too).
+//
+#if !defined(NO_SCAN_SSE2) && ( \
+    defined(__SSE2__) || defined(_M_X64) \
+    || (defined(_M_IX86_FP) && _M_IX86_FP >= 2) \
+)
+    #define SCAN_SSE2
+#endif
+
+
+// PROFILE/START samples the Rebol stack on a SIGPROF interval timer, which
+// is POSIX (setitimer()).  Other platforms get a PROFILE that fails.
+//
+#if !defined(TO_WINDOWS) && !defined(TO_EMSCRIPTEN) && !defined(TO_AMIGA)
+    #define SAMPLING_PROFILER
+#endif
+
+
+// EVAL_COMPUTED_GOTO makes the evaluator dispatch on the datatype of each
+// value--and on the parameter class of each argument it gathers--through
+// tables of label addresses instead of switch().  Taking the address of a
+// label (`&&label`) is a GCC/Clang extension, so the switch() is the default.
+// tests/eval-bench.r measures the per-step overhead to compare the two.
+//
+#ifdef EVAL_COMPUTED_GOTO
+    #if !defined(__GNUC__)
+        #error "EVAL_COMPUTED_GOTO needs GCC or Clang (labels as values)"
+    #endif
+#endif
+
+
 // It can be very difficult in release builds to know where a fail came
 // from.  This arises in pathological cases where an error only occurs in
 // release builds, or if making a full debug build bloats the code too much.
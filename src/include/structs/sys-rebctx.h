@@ -86,7 +86,8 @@
 #define SERIES_MASK_KEYLIST \
     (NODE_FLAG_NODE  /* NOT always dynamic */ \
         | FLAG_FLAVOR(KEYLIST) \
-        | SERIES_FLAG_LINK_NODE_NEEDS_MARK  /* ancestor */ )
+        | SERIES_FLAG_LINK_NODE_NEEDS_MARK  /* ancestor */ \
+        | SERIES_FLAG_MISC_NODE_NEEDS_MARK  /* key hash, may be nullptr */ )
 
 
 inline static REBARR *CTX_VARLIST(REBCTX *ctx)
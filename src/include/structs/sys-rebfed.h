@@ -323,6 +323,21 @@ struct Reb_Feed {
     //
     option(const REBVAL*) gotten;
 
+    // While a function call may move the variable ->gotten pointed to, it
+    // can't change which variable the word refers to.  So the lookup also
+    // notes the "slot" it found, as the container (a varlist or LET patch)
+    // and index.  If the feed is still at the same ->value with the same
+    // specifier after the call, the pointer can be recalculated from that
+    // instead of redoing the lookup.  See Lookup_Feed_Word().
+    //
+    // (The container stays alive as long as the word and specifier do, and
+    // the ->slot_value is nulled on each fetch, like ->gotten is.)
+    //
+    const RELVAL *slot_value;  // ->value the slot was found for, or nullptr
+    REBSPC *slot_specifier;
+    REBARR *slot_container;
+    REBLEN slot_index;
+
   #if defined(DEBUG_EXPIRED_LOOKBACK)
     //
     // On each call to Fetch_Next_In_Feed, it's possible to ask it to give
@@ -57,4 +57,11 @@ struct Reb_State {
     // the signal mask and restoring it at the trap states.
     //
     REBFLGS saved_sigmask;
+
+    // Likewise DO/BUDGET and rebValueBudgeted() tighten the evaluation budget
+    // and put it back afterward.  A budget that runs out fails, and that
+    // would jump past the code that puts it back.
+    //
+    REBI64 saved_budget_tick;
+    REBI64 saved_budget_usec;
 };
@@ -321,6 +321,7 @@ inline static void INIT_BINDING_MAY_MANAGE(
     UNUSED(f);
 
     m_cast(REBSER*, binding)->leader.bits |= NODE_FLAG_MANAGED;  // GC sees...
+    Keep_From_Lazy_Sweep(binding);
 }
 
 
@@ -412,6 +413,7 @@ inline static REBCTX *VAL_WORD_CONTEXT(const REBVAL *v) {
             == FRM(LINK(KeySource, binding))->key_tail  // not fulfilling
     );
     binding->leader.bits |= NODE_FLAG_MANAGED;  // !!! review managing needs
+    Keep_From_Lazy_Sweep(binding);
     REBCTX *c = CTX(binding);
     FAIL_IF_INACCESSIBLE_CTX(c);
     return c;
@@ -449,6 +451,59 @@ inline static REBCTX *VAL_WORD_CONTEXT(const REBVAL *v) {
 //
 
 
+//=//// VIRTUAL BINDING CACHE /////////////////////////////////////////////=//
+//
+// Looking up a word under a chain of virtual binding patches (e.g. in the
+// body of a FOR-EACH or after a LET) means walking the chain and searching
+// the keys of each patch's context.  The answer only depends on the patch at
+// the head of the chain, the spelling, and if the word is a SET-WORD!...as
+// a patch (and the length of context it covers) can't change once made.  So
+// it is remembered in a direct-mapped table, for loop bodies that look up
+// the same words over and over.
+//
+// LET patches are usually new each time through a loop body, but they are
+// cheap to check.  So the table is keyed by the first patch in the chain
+// that isn't a LET.
+//
+// A miss remembers the last patch in the chain, as the frame at the bottom
+// of the chain can be filled in after the patch is made (see Derive_Specifier)
+//
+// Patches are only freed by the GC, so entries are from a "generation" that
+// every recycle ends.  (Checking that is cheaper than clearing the table.)
+// The table is TG_Virtual_Cache, see %sys-core.h for the entry layout.
+//
+
+inline static struct Reb_Virtual_Cache_Entry *Virtual_Cache_Entry(
+    const REBARR *patch,
+    const REBSYM *spelling
+){
+    uint32_t hash = (
+        cast(uint32_t, cast(uintptr_t, patch) >> 3)
+        ^ cast(uint32_t, cast(uintptr_t, spelling) >> 3) * 31
+    ) * 2654435761u;  // Knuth's multiplicative hash, use the high bits
+    return &TG_Virtual_Cache[hash >> (32 - VIRTUAL_CACHE_BITS)];
+}
+
+inline static void Remember_Virtual_Lookup(
+    struct Reb_Virtual_Cache_Entry *entry,  // nullptr if only LETs seen
+    const REBARR *patch,
+    const REBSYM *spelling,
+    bool set_word,
+    REBARR *container,
+    REBLEN index
+){
+    if (not entry)
+        return;
+
+    entry->generation = TG_Virtual_Cache_Generation;
+    entry->patch = patch;
+    entry->spelling = spelling;
+    entry->set_word = set_word;
+    entry->container = container;
+    entry->index = index;
+}
+
+
 // Find the context a word is bound into.  This must account for the various
 // binding forms: Relative Binding, Derived Binding, and Virtual Binding.
 //
@@ -477,43 +532,66 @@ inline static option(REBARR*) Get_Word_Container(
         goto not_virtually_bound;
 
   blockscope {
-    //
-    // There was caching to assist with this previously...but it was complex
-    // and needs to be rethought.  Hence we have no way of knowing if
-    // this word is overridden without doing a linear search.  Do it
-    // and then save the hit or miss information in the word for next use.
-    //
     const REBSTR *spelling = VAL_WORD_SYMBOL(VAL_UNESCAPED(any_word));
+    bool set_word = (REB_SET_WORD == CELL_KIND(VAL_UNESCAPED(any_word)));
 
+    // Search the patches linearly, until the first one that isn't a LET.
+    // If it was looked up from there before, the cache has the answer.
+    // Otherwise keep searching, and save the hit or miss in the cache (and
+    // in the word, though that isn't used yet).
+    //
     // !!! Virtual binding could use the bind table as a kind of next
     // level cache if it encounters a large enough object to make it
     // wortwhile?
     //
+    struct Reb_Virtual_Cache_Entry *entry = nullptr;
+    const REBARR *head = nullptr;
+    REBARR *last = nullptr;
     do {
         if (GET_SUBCLASS_FLAG(PATCH, specifier, LET)) {
             if (LINK(PatchSymbol, specifier) == spelling) {
+                Remember_Virtual_Lookup(
+                    entry, head, spelling, set_word, specifier, 1
+                );
                 *index_out = 1;  // !!! lie, review
                 return specifier;
             }
             goto skip_miss_patch;
         }
 
+        if (not entry) {
+            entry = Virtual_Cache_Entry(specifier, spelling);
+            if (
+                entry->patch == specifier
+                and entry->spelling == spelling
+                and entry->set_word == set_word
+                and entry->generation == TG_Virtual_Cache_Generation
+            ){
+                if (entry->index != 0) {
+                    *index_out = entry->index;
+                    return entry->container;
+                }
+                specifier = NextPatch(entry->container);
+                goto not_virtually_bound;
+            }
+            head = specifier;
+        }
+
         REBARR *overbind;  // avoid goto-past-initialization warning
         overbind = ARR(BINDING(ARR_SINGLE(specifier)));
         if (not IS_VARLIST(overbind)) {  // a patch-formed LET overload
             if (LINK(PatchSymbol, overbind) == spelling) {
+                Remember_Virtual_Lookup(
+                    entry, head, spelling, set_word, overbind, 1
+                );
                 *index_out = 1;
                 return overbind;
             }
             goto skip_miss_patch;
         }
 
-        if (
-            IS_SET_WORD(ARR_SINGLE(specifier))
-            and REB_SET_WORD != CELL_KIND(VAL_UNESCAPED(any_word))
-        ){
+        if (IS_SET_WORD(ARR_SINGLE(specifier)) and not set_word)
             goto skip_miss_patch;
-        }
 
       blockscope {
         REBCTX *overload = CTX(overbind);
@@ -543,19 +621,24 @@ inline static option(REBARR*) Get_Word_Container(
             // we have to store the head of the chain.  Review.
             //
             INIT_VAL_WORD_VIRTUAL_MONDEX(any_word, index % MONDEX_MOD);
+            Remember_Virtual_Lookup(
+                entry, head, spelling, set_word, CTX_VARLIST(overload), index
+            );
             *index_out = index;
             return CTX_VARLIST(overload);
         }
       }
       skip_miss_patch:
+        last = specifier;
         specifier = NextPatch(specifier);
     } while (
         specifier and not IS_VARLIST(specifier)
     );
 
-    // Update the cache to say we miss on this particular specifier
+    // Update the caches to say we miss on this particular specifier
     //
     INIT_VAL_WORD_VIRTUAL_MONDEX(any_word, MONDEX_MOD);
+    Remember_Virtual_Lookup(entry, head, spelling, set_word, last, 0);
 
     // The linked list of specifiers bottoms out with either null or the
     // varlist of the frame we want to bind relative values with.  So
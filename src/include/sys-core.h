@@ -248,6 +248,53 @@ typedef struct rebol_stats {
     REBLEN  Objects;
 } REB_STATS;
 
+//-- Recycler counters, kept in all builds (see STATS/GC, rebGCStats())
+#define GC_PAUSE_BUCKETS 6  // <100us, <1ms, <10ms, <100ms, <1s, and longer
+#define GC_MAX_DEFERRALS 4  // most auto recycles in a row gc-interval puts off
+
+typedef struct rebol_gc_stats {
+    REBI64  Recycles;
+    REBI64  Mark_Usec;  // totals of CPU time, in microseconds
+    REBI64  Sweep_Usec;
+    REBI64  Last_Mark_Usec;
+    REBI64  Last_Sweep_Usec;
+    REBI64  Max_Pause_Usec;
+    REBI64  Pauses[GC_PAUSE_BUCKETS];
+    REBI64  Marked;  // nodes marked by tracing (not symbols or API roots)
+    REBI64  Freed;  // includes nodes freed by lazy sweeping
+    REBI64  Last_Marked;
+    REBI64  Last_Freed;
+} REB_GC_STATS;
+
+// PATH! steps that pick a WORD! out of an object or map note where the word
+// was found, in a table indexed by the address of the picker cell.  Entries
+// are only hints: a hit is checked against the key actually at that index,
+// so stale entries for freed paths or keylists are harmless (see PD_Context)
+//
+#define PICK_CACHE_SIZE 1024  // must be a power of 2
+
+typedef struct rebol_pick_cache {
+    const RELVAL *picker;  // the WORD! cell in the path
+    const REBSER *shape;  // keylist of the object, or pairlist of the map
+    REBLEN index;  // 1-based, where the word was found in the shape
+} REB_PICK_CACHE;
+
+// Virtually bound word lookups are remembered in a table indexed by a hash
+// of the patch at the head of the chain and the spelling, see %sys-bind.h.
+// Entries start zeroed, and a null `patch` never matches a real one.
+//
+#define VIRTUAL_CACHE_BITS 10
+#define VIRTUAL_CACHE_SIZE (1 << VIRTUAL_CACHE_BITS)
+
+struct Reb_Virtual_Cache_Entry {
+    REBLEN generation;  // TG_Virtual_Cache_Generation when it was stored
+    const REBARR *patch;  // head of the chain the word was looked up in
+    const REBSYM *spelling;
+    bool set_word;
+    REBARR *container;  // context or LET patch if hit, last patch if miss
+    REBLEN index;  // 0 if miss
+};
+
 //-- Options of various kinds:
 typedef struct rebol_opts {
     bool  watch_recycle;
@@ -422,12 +469,38 @@ enum rebol_signals {
 
     // SIG_EVENT_PORT is to-be-documented
     //
-    SIG_EVENT_PORT = 1 << 3
+    SIG_EVENT_PORT = 1 << 3,
+
+    // SIG_PROFILE is set by the SIGPROF timer of PROFILE/START.  The signal
+    // handler can't safely look at the frame stack (it may be half built),
+    // so the sample of the stack is taken when the evaluator next checks.
+    //
+    SIG_PROFILE = 1 << 4,
+
+    // SIG_SWEEP means the SER_POOL ran out of free units while a lazy sweep
+    // is pending.  Sweeping frees nodes and runs handle cleaners, so it is
+    // put off until the evaluator is between steps (see Sweep_Lazily()).
+    //
+    SIG_SWEEP = 1 << 5
 };
 
+// This is called from signal handlers (SIGPROF, and rebHalt() on Ctrl-C), so
+// it only sets the flag and cuts the countdown short.  The steps that cutting
+// it short skips are noted for Do_Signals_Throws(), which does the accounting.
+//
 inline static void SET_SIGNAL(REBFLGS f) { // used in %sys-series.h
     Eval_Signals |= f;
-    Eval_Count = 1;
+    if (Eval_Count > 1) {
+        Eval_Count_Skipped = Eval_Count - 1;
+        Eval_Count = 1;
+    }
+}
+
+// Eval_Count counts down to the next Do_Signals_Throws(), which adds the
+// steps that were taken into Eval_Cycles.  So the total is the sum of both.
+//
+inline static REBI64 Total_Eval_Cycles(void) {
+    return Eval_Cycles + Eval_Dose - Eval_Count - Eval_Count_Skipped;
 }
 
 #define GET_SIGNAL(f) \
@@ -96,6 +96,28 @@
 #endif
 
 
+// When built with EVAL_COMPUTED_GOTO (see %reb-config.h), the evaluator's
+// switch() on the datatype and the switch() on the parameter class during
+// argument fulfillment are entered with `goto *table[n]`.  Each case gets a
+// label as well as the `case` through DISPATCH_CASE(), and DISPATCH_ENTRY()
+// puts the address of that label in the table.
+//
+// The switch() statement itself stays, so `break` means the same thing in
+// both builds.  The tables are filled in on a function's first run, because
+// label addresses are only available inside the function--and C++ has no
+// equivalent of GCC's ranged initializers (e.g. `[0 ... 255] = &&label`).
+//
+#ifdef EVAL_COMPUTED_GOTO
+    #define DISPATCH_CASE(prefix,n)     case n: prefix##_##n
+    #define DISPATCH_DEFAULT(prefix)    default: prefix##_default
+    #define DISPATCH_ENTRY(table,prefix,n) \
+        table[n] = &&prefix##_##n
+#else
+    #define DISPATCH_CASE(prefix,n)     case n
+    #define DISPATCH_DEFAULT(prefix)    default
+#endif
+
+
 // The evaluator publishes its internal states in this header file, so that
 // a frame can be made with e.g. `FLAG_STATE_BYTE(ST_EVALUATOR_REEVALUATING)`
 // to start in various points of the evaluation process.  When doing so, be
@@ -150,7 +172,7 @@ inline static bool Did_Init_Inert_Optimize_Complete(
     Literal_Next_In_Feed(out, feed);
 
     if (KIND3Q_BYTE_UNCHECKED(feed->value) == REB_WORD) {
-        feed->gotten = Lookup_Word(feed->value, FEED_SPECIFIER(feed));
+        feed->gotten = Lookup_Feed_Word(feed);
         if (
             not feed->gotten
             or not IS_ACTION(unwrap(feed->gotten))
@@ -244,6 +244,7 @@ inline static void Detect_Feed_Pointer_Maybe_Fetch(
             );
             feed->value = &feed->fetched;
 
+            Untrack_Root_Array(inst1);
             GC_Kill_Series(inst1);  // not manuals-tracked
             break; }
 
@@ -257,6 +258,7 @@ inline static void Detect_Feed_Pointer_Maybe_Fetch(
                 Copy_Cell(&feed->fetched, single);
                 feed->value = &feed->fetched;
             }
+            Untrack_Root_Array(inst1);
             GC_Kill_Series(inst1);
             break; }
 
@@ -369,6 +371,7 @@ inline static void Fetch_Next_In_Feed(REBFED *feed) {
     // a version that just trashes ->gotten in the debug build vs. null.
     //
     feed->gotten = nullptr;
+    feed->slot_value = nullptr;
 
   retry_splice:
     if (FEED_PENDING(feed)) {
@@ -429,6 +432,46 @@ inline static void Fetch_Next_In_Feed(REBFED *feed) {
 }
 
 
+// Look up the WORD! at the feed's ->value for use as ->gotten.  If it was
+// looked up before a function call nulled out ->gotten, then the variable
+// is found again through the slot that was noted at that time.
+//
+inline static option(const REBVAL*) Lookup_Feed_Word(REBFED *feed) {
+    REBSPC *specifier = FEED_SPECIFIER(feed);
+
+    REBARR *a;
+    if (
+        feed->slot_value == feed->value
+        and feed->slot_specifier == specifier
+    ){
+        a = feed->slot_container;
+    }
+    else {
+        REBLEN index;
+        a = try_unwrap(Get_Word_Container(&index, feed->value, specifier));
+        if (not a) {
+            feed->slot_value = nullptr;
+            return nullptr;
+        }
+        feed->slot_value = feed->value;
+        feed->slot_specifier = specifier;
+        feed->slot_container = a;
+        feed->slot_index = index;
+    }
+
+    const REBVAL *var;
+    if (IS_PATCH(a))
+        var = SPECIFIC(ARR_SINGLE(a));
+    else if (GET_SERIES_FLAG(a, INACCESSIBLE))
+        var = nullptr;
+    else
+        var = CTX_VAR(CTX(a), feed->slot_index);
+
+    assert(var == try_unwrap(Lookup_Word(feed->value, specifier)));
+    return var;
+}
+
+
 // Most calls to Fetch_Next_In_Frame() are no longer interested in the
 // cell backing the pointer that used to be in f->value (this is enforced
 // by a rigorous test in DEBUG_EXPIRED_LOOKBACK).  Special care must be
@@ -523,6 +566,8 @@ inline static REBFED* Alloc_Feed(void) {
     Init_Trash(Prep_Cell(&feed->fetched));
     Init_Trash(Prep_Cell(&feed->lookback));
 
+    feed->slot_value = nullptr;
+
     REBSER *s = &feed->singular;  // SER() not yet valid
     s->leader.bits = NODE_FLAG_NODE | FLAG_FLAVOR(FEED);
     SER_INFO(s) = SERIES_INFO_MASK_NONE;
@@ -113,6 +113,7 @@ enum Reb_Series_Flavor {
     FLAVOR_MOLDSTACK,
 
     FLAVOR_HASHLIST,  // outlier, sizeof(REBLEN)...
+    FLAVOR_SYMBOLHASHLIST,  // also outlier, sizeof(uint32_t)
     FLAVOR_BOOKMARKLIST,  // also outlier, sizeof(struct Reb_Bookmark)
 
     // v-- everything below this line has width=1
@@ -159,6 +160,8 @@ inline static size_t Wide_For_Flavor(enum Reb_Series_Flavor flavor) {
         return sizeof(struct Reb_Bookmark);
     if (flavor == FLAVOR_HASHLIST)
         return sizeof(REBLEN);
+    if (flavor == FLAVOR_SYMBOLHASHLIST)
+        return sizeof(uint32_t);
     return sizeof(void*);
 }
 
@@ -32,6 +32,11 @@ PVAR REBINT PG_Boot_Level;  // User specified startup level
 PVAR REBU64 PG_Mem_Usage;   // Overall memory used
 PVAR REBU64 PG_Mem_Limit;   // Memory limit set by SECURE
 
+#if defined(MMAP_LARGE_SERIES)
+    PVAR REBLEN PG_Page_Size;  // large series data is mmap()'d in pages
+    PVAR bool PG_Huge_Pages;  // R3_HUGE_PAGES, ask for THP on large series
+#endif
+
 // In Ren-C, words are REBSER nodes (REBSTR subtype).  They may be GC'd (unless
 // they are in the %words.r list, in which case their canon forms are
 // protected in order to do SYM_XXX switch statements in the C source, etc.)
@@ -47,10 +52,8 @@ PVAR const REBSYM *PG_Trash_Canon;  // Preallocated ~trash~ bad word
 
 PVAR REBSER *PG_Symbol_Canons; // Canon symbol pointers for words in %words.r
 PVAR REBSER *PG_Symbols_By_Hash; // Symbol REBSTR pointers indexed by hash
-PVAR REBLEN PG_Num_Symbol_Slots_In_Use; // Total symbol hash slots (+deleteds)
-#if !defined(NDEBUG)
-    PVAR REBLEN PG_Num_Symbol_Deleteds; // Deleted symbol hash slots "in use"
-#endif
+PVAR REBSER *PG_Symbol_Hashes; // uint32_t hash of the symbol in each slot
+PVAR REBLEN PG_Num_Symbol_Slots_In_Use; // Total symbol hash slots in use
 PVAR const REBSYM *PG_Bar_Canon;  // fast canon value for testing for `|`
 
 PVAR REBVAL *Lib_Context;
@@ -138,6 +141,12 @@ PVAR REBARR *PG_Extension_Types;  // array of datatypes created by extensions
 // when implemented that way. Needs research!!!!
 PVAR REBFLGS Eval_Signals;   // Signal flags
 
+PVAR REBVAL *PG_Profile_Samples;  // MAP! of folded stack TEXT! to count
+PVAR REBI64 PG_Profile_Sample_Count;  // samples taken since PROFILE/START
+PVAR bool PG_Profiling;  // PROFILE/START's SIGPROF timer is running
+PVAR REBFRM * volatile PG_Profile_Frame;  // action running at last SIGPROF
+PVAR const REBSYM * volatile PG_Profile_Label;  // ...and its label then
+
 PVAR REBDEV *PG_Device_List;  // Linked list of R3-Alpha-style "devices"
 
 
@@ -171,6 +180,25 @@ TVAR REBINT GC_Ballast;     // Bytes allocated to force automatic GC
 TVAR bool GC_Disabled;      // true when RECYCLE/OFF is run
 TVAR REBSER *GC_Guarded; // A stack of GC protected series and values
 PVAR REBSER *GC_Mark_Stack; // Series pending to mark their reachables as live
+
+TVAR bool GC_Lazy_Sweep;  // true when RECYCLE/LAZY is in effect
+TVAR bool GC_Sweep_Pending;  // a lazy sweep hasn't finished (see GC_Unswept)
+TVAR REBSER *GC_Unswept;  // SER_POOL segments the lazy sweep has yet to visit
+TVAR bool GC_Auto_Trim;  // automatic recycles free mostly-empty pool segments
+
+TVAR REBLEN GC_Pace_Growth;  // R3_GC_PACING defaults for SYSTEM/OPTIONS/GC-XXX
+TVAR REBLEN GC_Pace_Pause;
+TVAR REBLEN GC_Pace_Interval;
+TVAR const char *GC_Pace_Decision;  // what set the last ballast, for STATS
+TVAR REBI64 GC_Paced_Ballast;  // ballast the last recycle decided on
+TVAR REBI64 GC_Last_Pause;  // microseconds of CPU time the last recycle took
+TVAR REBI64 GC_Last_End;  // when it ended (in CPU time microseconds)
+TVAR REBLEN GC_Deferred;  // automatic recycles put off for GC-INTERVAL
+TVAR REBLEN GC_Deferred_In_Row;  // ...since the last one that ran
+TVAR REB_GC_STATS GC_Stats;  // always-on counters, see STATS/GC
+TVAR REB_PICK_CACHE TG_Pick_Cache[PICK_CACHE_SIZE];  // see PD_Context()
+TVAR struct Reb_Virtual_Cache_Entry TG_Virtual_Cache[VIRTUAL_CACHE_SIZE];
+TVAR REBLEN TG_Virtual_Cache_Generation;  // incremented by every recycle
 TVAR REBSER **Prior_Expand; // Track prior series expansions (acceleration)
 
 #if !defined(NDEBUG)  // Used by the FUZZ native to inject memory failures
@@ -183,6 +211,7 @@ TVAR REBBIN *TG_Byte_Buf; // temporary byte buffer used mainly by raw print
 TVAR REBSTR *TG_Mold_Buf; // temporary UTF8 buffer - used mainly by mold
 
 TVAR REBSER *GC_Manuals;    // Manually memory managed (not by GC)
+TVAR REBSER *GC_Roots;  // Unmanaged API arrays that aren't in GC_Manuals
 
 #if !defined(OS_STACK_GROWS_UP) && !defined(OS_STACK_GROWS_DOWN)
     TVAR bool TG_Stack_Grows_Up; // Will be detected via questionable method
@@ -232,8 +261,11 @@ TVAR struct Reb_State *TG_Jump_List; // Saved state for TRAP (CPU state, etc.)
 TVAR REBI64 Eval_Cycles;    // Total evaluation counter (upward)
 TVAR REBI64 Eval_Limit;     // Evaluation limit (set by secure)
 TVAR int_fast32_t Eval_Count;     // Evaluation counter (downward)
+TVAR int_fast32_t Eval_Count_Skipped;  // Counts SET_SIGNAL() cut short
 TVAR uint_fast32_t Eval_Dose;      // Evaluation counter reset value
 TVAR REBFLGS Eval_Sigmask;   // Masking out signal flags
+TVAR REBI64 Eval_Budget_Tick;   // Total_Eval_Cycles() budget ends at, or 0
+TVAR REBI64 Eval_Budget_Usec;   // CPU clock time budget ends at, or 0
 
 TVAR REBFLGS Trace_Flags;    // Trace flag
 TVAR REBINT Trace_Level;    // Trace depth desired
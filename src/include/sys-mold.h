@@ -23,6 +23,17 @@
 
 #define MOLD_BUF TG_Mold_Buf
 
+// A streaming mold (MOLD_FLAG_STREAM) hands its output to this hook a chunk
+// at a time, instead of accumulating all of it in the mold buffer.  The bytes
+// point into the mold buffer, so they must be used before anything else can
+// mold (see Flush_Mold()).
+//
+typedef void MOLD_FLUSH_HOOK(REB_MOLD *mo, const REBYTE *utf8, REBSIZ size);
+
+// How much a streaming mold accumulates before it is flushed
+//
+#define MOLD_STREAM_SIZE (64 * 1024)
+
 struct rebol_mold {
     REBSTR *series;     // destination series (utf8)
     REBLEN index;       // codepoint index where mold starts within series
@@ -34,6 +45,8 @@ struct rebol_mold {
     REBYTE period;      // for decimal point
     REBYTE dash;        // for date fields
     REBYTE digits;      // decimal digits
+    MOLD_FLUSH_HOOK *flush;  // where output goes if MOLD_FLAG_STREAM
+    const REBVAL *sink;  // e.g. the PORT! a flush hook writes to
 };
 
 #define Drop_Mold_If_Pushed(mo) \
@@ -42,6 +55,9 @@ struct rebol_mold {
 #define Drop_Mold(mo) \
     Drop_Mold_Core((mo), false)
 
+#define Flush_Mold(mo) \
+    Flush_Mold_Core((mo), false)
+
 #define Mold_Value(mo,v) \
     Mold_Or_Form_Value((mo), (v), false)
 
@@ -79,7 +95,8 @@ enum REB_Mold_Opts {
     MOLD_FLAG_LINES  = 1 << 6, // add a linefeed between each value
     MOLD_FLAG_LIMIT = 1 << 7, // Limit length to mold->limit, then "..."
     MOLD_FLAG_RESERVE = 1 << 8,  // At outset, reserve capacity for buffer
-    MOLD_FLAG_WAS_TRUNCATED = 1 << 9  // Set true upon truncation
+    MOLD_FLAG_WAS_TRUNCATED = 1 << 9,  // Set true upon truncation
+    MOLD_FLAG_STREAM = 1 << 10  // Flush output to mo->flush as it goes
 };
 
 #define MOLD_MASK_NONE 0
@@ -121,11 +121,20 @@
 //
 inline static void *Try_Alloc_Node(REBLEN pool_id)
 {
+  #if defined(NODE_MAGAZINES)
+    REBMAG *mag = &TG_Magazines[pool_id];
+    if (mag->count == 0 and not Try_Refill_Magazine(pool_id))
+        return nullptr;
+  #else
     REBPOL *pool = &Mem_Pools[pool_id];
     if (not pool->first) {  // pool has run out of nodes
-        if (not Try_Fill_Pool(pool))  // attempt to refill it
+        if (pool_id == SER_POOL and GC_Sweep_Pending)
+            Signal_Lazy_Sweep();  // not safe to sweep here, see Sweep_Lazily()
+
+        if (not Try_Fill_Pool(pool))  // attempt to refill
             return nullptr;
     }
+  #endif
 
   #if !defined(NDEBUG)
     if (PG_Fuzz_Factor != 0) {
@@ -141,6 +150,9 @@ inline static void *Try_Alloc_Node(REBLEN pool_id)
     }
   #endif
 
+  #if defined(NODE_MAGAZINES)
+    REBPLU *unit = mag->units[--mag->count];
+  #else
     assert(pool->first);
 
     REBPLU *unit = pool->first;
@@ -150,6 +162,7 @@ inline static void *Try_Alloc_Node(REBLEN pool_id)
         pool->last = nullptr;
 
     pool->free--;
+  #endif
 
   #ifdef DEBUG_MEMORY_ALIGN
     if (cast(uintptr_t, unit) % sizeof(REBI64) != 0) {
@@ -159,8 +172,8 @@ inline static void *Try_Alloc_Node(REBLEN pool_id)
             cast(int, sizeof(REBI64))
         );
         printf("Pool Unit address is %p and pool-first is %p\n",
-            cast(void*, pool),
-            cast(void*, pool->first)
+            cast(void*, &Mem_Pools[pool_id]),
+            cast(void*, Mem_Pools[pool_id].first)
         );
         panic (unit);
     }
@@ -205,6 +218,19 @@ inline static void Free_Node(REBLEN pool_id, REBNOD* node)
 
     mutable_FIRST_BYTE(unit->headspot) = FREED_SERIES_BYTE;
 
+    // A unit in a segment that a lazy sweep hasn't reached yet can't be handed
+    // out again, because the sweep would take its new contents for garbage.
+    // The sweep will put it on the free list when it gets there.
+    //
+    if (pool_id == SER_POOL and GC_Sweep_Pending and Is_Node_Unswept(node))
+        return;
+
+  #if defined(NODE_MAGAZINES)  // release builds only, see %reb-config.h
+    REBMAG *mag = &TG_Magazines[pool_id];
+    if (mag->count == MAGAZINE_SIZE)
+        Return_Magazine_Units(pool_id);  // gives half back to the pool
+    mag->units[mag->count++] = unit;
+  #else
     REBPOL *pool = &Mem_Pools[pool_id];
 
   #ifdef NDEBUG
@@ -222,16 +248,21 @@ inline static void Free_Node(REBLEN pool_id, REBNOD* node)
 
     bool out_of_memory = false;
 
-    if (not pool->last) {  // Fill pool if empty
-        if (not Try_Fill_Pool(pool))
+    // (A lazy sweep in progress will be refilling the SER_POOL by itself, and
+    // adding a segment each time it empties would just grow the heap.)
+    //
+    if (not pool->last and not (pool_id == SER_POOL and GC_Sweep_Pending)) {
+        if (not Try_Fill_Pool(pool))  // Fill pool if empty
             out_of_memory = true;
     }
 
-    if (out_of_memory) {
+    if (out_of_memory or not pool->last) {
         //
         // We don't want Free_Node to fail with an "out of memory" error, so
         // just fall back to the release build behavior in this case.
         //
+        if (not pool->first)
+            pool->last = unit;
         unit->next_if_free = pool->first;
         pool->first = unit;
     }
@@ -245,6 +276,19 @@ inline static void Free_Node(REBLEN pool_id, REBNOD* node)
   #endif
 
     pool->free++;
+  #endif
+}
+
+
+// While a lazy sweep is pending, a managed node in a segment it hasn't swept
+// yet is garbage unless the last recycle marked it.  That's not right for a
+// node that was unmanaged at the time and has been managed since, or a node
+// that was only weakly referenced (e.g. by the symbol table) and has been
+// found again.  Such nodes have to get the mark a live node would have.
+//
+inline static void Keep_From_Lazy_Sweep(const void *node) {
+    if (GC_Sweep_Pending)
+        Keep_Unswept_Node(node);
 }
 
 
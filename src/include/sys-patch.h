@@ -167,6 +167,7 @@ inline static REBARR *Make_Patch_Core(
                 //
                 assert(reuse);
                 USED(reuse);
+                Keep_From_Lazy_Sweep(variant);  // may be unswept garbage
                 SET_SUBCLASS_FLAG(PATCH, variant, REUSED);
                 return variant;
             }
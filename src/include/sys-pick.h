@@ -77,6 +77,17 @@
 #define PVS_PICKER(pvs) \
     pvs->u.ref.picker
 
+
+// The entry of TG_Pick_Cache a picker cell would use.  Path dispatchers that
+// check an entry must not trust it on pointer identity alone: the shape may
+// have been freed and its node reused, and the picker cell may now hold
+// some other word.  So they also test the key at the entry's index.
+//
+inline static REB_PICK_CACHE *Pick_Cache_For(const RELVAL *picker) {
+    uintptr_t n = cast(uintptr_t, picker) / sizeof(RELVAL);
+    return &TG_Pick_Cache[n & (PICK_CACHE_SIZE - 1)];
+}
+
 inline static bool Get_Path_Throws_Core(
     REBVAL *out,
     const RELVAL *any_path,
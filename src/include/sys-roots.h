@@ -37,8 +37,11 @@
 // purpose.  It's not particularly necessary to have API handles use REBSER
 // nodes--though the 2*sizeof(REBVAL) provides some optimality, and it
 // means that REBSER nodes can be recycled for more purposes.  But it would
-// potentially be better to have them in their own pools, because being
-// roots could be discovered without a "pre-pass" in the GC.
+// potentially be better to have them in their own pools.
+//
+// The GC doesn't discover them with a "pre-pass" over all the series nodes.
+// Managed handles are linked into the frame that owns them, and unmanaged
+// ones are kept in the GC_Roots list (see Track_Root_Array()).
 //
 
 
@@ -119,6 +122,48 @@ inline static void Unlink_Api_Handle_From_Frame(REBARR *a)
 }
 
 
+// Managed API handles are found by the GC through the alloc_value_list of
+// the frames on the stack, and unmanaged arrays from Make_Array() are in
+// the GC_Manuals list.  But some unmanaged arrays are deliberately kept out
+// of the manuals list: handles given indefinite lifetime by rebUnmanage(),
+// and the instructions made by rebQ() and friends (which are freed by the
+// feed that consumes them).  Those are tracked in GC_Roots instead, so the
+// GC can mark what they hold without visiting every series node.
+//
+inline static void Track_Root_Array(REBARR *a)
+{
+    assert(NOT_SERIES_FLAG(a, MANAGED));
+
+    if (SER_FULL(GC_Roots))
+        Extend_Series(GC_Roots, 8);
+
+    *SER_AT(REBARR*, GC_Roots, SER_USED(GC_Roots)) = a;
+    SET_SERIES_USED(GC_Roots, SER_USED(GC_Roots) + 1);
+}
+
+inline static void Untrack_Root_Array(REBARR *a)
+{
+    REBARR **head = SER_HEAD(REBARR*, GC_Roots);
+    REBARR **last = head + SER_USED(GC_Roots) - 1;
+
+    // Roots are usually released in the reverse order they were made (e.g.
+    // instructions are consumed by a feed soon after they're created), so
+    // search from the end.
+    //
+    REBARR **pos = last;
+    for (; *pos != a; --pos) {
+      #if !defined(NDEBUG)
+        if (pos == head) {
+            printf("Array not in list of unmanaged API roots\n");
+            panic (a);
+        }
+      #endif
+    }
+    *pos = *last;
+    SET_SERIES_USED(GC_Roots, SER_USED(GC_Roots) - 1);
+}
+
+
 // We are introducing the containing node for this cell to the GC and can't
 // leave it trash.  If a pattern like `Do_Evaluation_Into(Alloc_Value(), ...)`
 // is used, then there might be a recycle during the evaluation that sees it.
@@ -158,6 +203,8 @@ inline static void Free_Value(REBVAL *v)
 
     if (GET_SERIES_FLAG(a, MANAGED))
         Unlink_Api_Handle_From_Frame(a);
+    else
+        Untrack_Root_Array(a);
 
     GC_Kill_Series(a);
 }
@@ -267,6 +267,11 @@ typedef struct rebol_scan_state {  // shared across all levels of a scan
     //
     REBFED *feed;
 
+    // The '\0' terminator of the UTF-8 string that `begin` points into.  The
+    // SSE2 skipping loops only read 16-byte blocks that end by this byte.
+    //
+    const REBYTE *tail;
+
     const REBSTR *file;  // file currently being scanned (or anonymous)
 
     REBLIN line;  // line number where current scan position is
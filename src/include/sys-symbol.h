@@ -128,6 +128,17 @@ inline static bool Same_Nonzero_Symid(SYMID a, SYMID b) {
 inline static OPT_SYMID ID_OF_SYMBOL(const REBSYM *s)
   { return cast(SYMID, SECOND_UINT16(s->info)); }
 
+// Each symbol keeps the case-insensitive hash it was interned with just past
+// its terminator, so GC_Kill_Interning() and keylist side indexes don't have
+// to hash the spelling again.  (It's copied bytewise, as the spelling can
+// leave it unaligned.)
+//
+inline static uint32_t Symbol_Hash(const REBSYM *symbol) {
+    uint32_t hash;
+    memcpy(&hash, SER_DATA(symbol) + STR_SIZE(symbol) + 1, sizeof(hash));
+    return hash;
+}
+
 inline static const REBSYM *Canon(SYMID symid) {
     assert(cast(REBLEN, symid) != 0);
     assert(cast(REBLEN, symid) < SER_USED(PG_Symbol_Canons));  // null if boot
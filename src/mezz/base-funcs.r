@@ -1188,3 +1188,82 @@ input-lines: redescribe [
 ](
     specialize :read-lines [src: _]
 )
+
+read-values: func [
+    {Makes a generator that yields top-level values from a file or port.}
+    src [port! file!]
+    /file "File to be associated with BLOCK!s and GROUP!s (default is SRC)"
+        [file! url!]
+    /chunk "Bytes to read from the port at a time (default is 65536)"
+        [integer!]
+][
+    if file? src [
+        file: default [src]
+        src: open src
+    ]
+    chunk: default [65536]
+
+    ; Only the unscanned part of the input is buffered.  A value is handed
+    ; back once TRANSCODE/NEXT finds something after it, as a value which
+    ; runs up to the end of the buffer may be continued by the next read.
+    ; Values cut off by the end of the buffer (or with an unclosed bracket
+    ; or string) are rescanned after reading more, with the size of the read
+    ; growing with the partial value so large values don't rescan for each
+    ; chunk.  A syntax error is raised as soon as it can't be blamed on the
+    ; end of the buffer cutting something off.
+    ;
+    return function compose [
+        <static> pos (to group! [make binary! chunk])
+        <static> port (groupify src)
+        <static> line (1)
+        <static> eof (false)
+    ][
+        cycle [
+            let start-line: line
+            let value
+            let rest
+            let error: trap [
+                [value rest]: transcode/file/line pos file 'line
+            ]
+            all [
+                not error
+                any [eof, not tail? rest]
+            ] then [
+                pos: rest
+                return :value  ; null if only whitespace and comments are left
+            ]
+            if eof [fail error]
+
+            ; More input can only fix an unclosed string or block, or a token
+            ; or UTF-8 character that runs into the end of the buffer.  (For
+            ; UTF-8, that's a lead byte in the last 3 bytes...BREAK makes the
+            ; FOR-EACH return null if there is one.)
+            ;
+            if error and (not any [
+                'scan-missing = error/id
+                all [
+                    'scan-invalid = error/id
+                    let token: as binary! error/arg2
+                    token = skip tail of pos negate length of token
+                ]
+                all [
+                    'bad-utf8 = error/id
+                    null? for-each b (skip tail of pos -3) [
+                        if b >= 192 [break]
+                    ]
+                ]
+            ]) [
+                fail error
+            ]
+            line: start-line
+
+            pos: remove/part head of pos pos
+            let data: read/part port max chunk length of pos
+            either empty? data [
+                eof: true
+            ][
+                append pos data
+            ]
+        ]
+    ]
+]
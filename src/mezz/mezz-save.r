@@ -55,6 +55,7 @@ save: function [
     /length "Save the length of the script content in the header"
     /compress "true = compressed, false = not, 'script = encoded string"
         [logic! word!]
+    /stream "Mold into the file a chunk at a time (no /LENGTH or /COMPRESS)"
 ][
     ; Recover common natives for words used as refinements.
     all_SAVE: all
@@ -116,6 +117,39 @@ save: function [
         header: body-of header
     ]
 
+    if stream [
+        ; Mold straight into the file (see MOLD/INTO), so the text of a big
+        ; value is never all in memory at once.  That rules out anything that
+        ; has to see the whole text first.
+        ;
+        if any [length compress find try header [checksum:]] [
+            fail "SAVE/STREAM can't be used with /LENGTH, /COMPRESS or checksum"
+        ]
+        if not file? where [
+            fail ["SAVE/STREAM only writes to a FILE!, not" type of where]
+        ]
+
+        ; The port is closed even if molding fails, and the partial file is
+        ; deleted so it can't be mistaken for a whole one.
+        ;
+        port: open/new/write where
+        error: trap [
+            if header [
+                write port unspaced [{REBOL} _ (mold header) newline]
+            ]
+            either all_SAVE [mold/all/only/into :value port] [
+                mold/only/into :value port
+            ]
+            write port "^/"  ; MOLD does not append a newline
+        ]
+        close port
+        if error [
+            attempt [delete where]
+            fail error
+        ]
+        return where
+    ]
+
     ; !!! Maybe /all should be the default?  See #2159
     data: either all_SAVE [mold/all/only :value] [
         mold/only :value
@@ -87,11 +87,10 @@ decode: function [
     all [
         cod: select system/codecs type
         f: :cod/decode
-        (data: f data)
     ] else [
         cause-error 'access 'no-codec type
     ]
-    data
+    return f data  ; may be falsey, e.g. a REBIN of #[false]
 ]
 
 
@@ -147,6 +147,7 @@
 %file/open.test.reb
 %file/split-path.test.reb
 %file/file-typeq.test.reb
+%file/read-map.test.reb
 
 %functions/adapt.test.reb
 %functions/augment.test.reb
@@ -165,6 +166,7 @@
 %functions/native.test.reb
 %functions/oneshot.test.reb
 %functions/predicate.test.reb
+%functions/read-values.test.reb
 %functions/redo.test.reb
 %functions/reframer.test.reb
 %functions/specialize.test.reb
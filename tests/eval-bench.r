@@ -0,0 +1,61 @@
+REBOL [
+    Title: {Evaluator Step Benchmark}
+    Description: {
+        Times how long the evaluator takes per expression, for expressions
+        that each exercise one branch of the datatype dispatch in
+        Eval_Maybe_Stale_Throws() (and for the actions, one parameter class
+        of the argument fulfillment in Process_Action_Maybe_Stale_Throws()).
+
+        Each case is a block of SIZE copies of an expression which is run
+        with DO, so the loop overhead is spread out over many steps.  The
+        numbers are meant to compare builds of the same source--e.g. with
+        and without EVAL_COMPUTED_GOTO--on the same machine.
+
+        Run with `r3 tests/eval-bench.r`, optionally passing a repeat count.
+    }
+]
+
+count: any [
+    attempt [to integer! first system/script/args]
+    100
+]
+
+size: 10000
+
+x: 1
+obj: make object! [a: 1]
+
+quote-arg: func ['v] [v]
+soft-arg: func [:v] [v]
+one-arg: func [v] [v]
+
+bench: func [label [text!] expression [block!]] [
+    let code: append/dup copy [] expression size
+    do code  ; warm up (and fail early if the expression is broken)
+    let start: now/precise
+    repeat count [do code]
+    let time: difference now/precise start
+    let nanoseconds: (to decimal! time) * 1e9 / (count * size)
+    print [
+        label "-" time
+        "-" round/to nanoseconds 0.01 "ns per expression"
+    ]
+]
+
+bench "integer!" [1]
+bench "integer! and comma!" [1,]
+bench "text!" ["a"]
+bench "block!" [[a]]
+bench "quoted!" ['a]
+bench "word!" [x]
+bench "get-word!" [:x]
+bench "set-word!" [x: 1]
+bench "group!" [(1)]
+bench "path!" [obj/a]
+bench "tuple!" [obj.a]
+bench "get-path!" [:obj/a]
+bench "native, normal arg" [negate 1]
+bench "native, enfix" [1 + 1]
+bench "func, normal arg" [one-arg 1]
+bench "func, hard quoted arg" [quote-arg a]
+bench "func, soft quoted arg" [soft-arg a]
@@ -15,3 +15,6 @@
 
 <r3>
 ; the test can work with R2 if using R2/Forward, or with R3
+
+<node-magazines>
+; the test is meant to be used only when built with NODE_MAGAZINES
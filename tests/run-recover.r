@@ -20,11 +20,17 @@ do %test-framework.r
 
 do-core-tests: function [return: <none>] [
     ; Check if we run R3 or R2.
-    flags: pick [
+    flags: copy pick [
         [<64bit> <r3only> <r3>]
         [<32bit> <r2only>]
     ] not blank? in system 'catalog
 
+    ; NODE-ALLOC-BENCHMARK fails unless built with NODE_MAGAZINES
+    ;
+    if not error? trap [node-alloc-benchmark 1 1] [
+        append flags <node-magazines>
+    ]
+
     ; calculate interpreter checksum
     case [
         #"/" = first try match file! system/options/boot [